@@ -58,6 +58,8 @@ static macro_queue *define_queue, *undef_queue;
 /* General output routines.  */
 static void scan_translation_unit (cpp_reader *);
 static void scan_translation_unit_directives_only (cpp_reader *);
+static void directives_only_nooutput_cb (cpp_reader *, CPP_DO_task,
+					 void *, ...);
 static void scan_translation_unit_trad (cpp_reader *);
 static void account_for_newlines (const unsigned char *, size_t);
 static int dump_macro (cpp_reader *, cpp_hashnode *, void *);
@@ -90,7 +92,13 @@ preprocess_file (cpp_reader *pfile)
 {
   /* A successful cpp_read_main_file guarantees that we can call
      cpp_scan_nooutput or cpp_get_token next.  */
-  if (flag_no_output && pfile->buffer)
+  if (flag_no_output && pfile->buffer
+      && cpp_get_options (pfile)->directives_only
+      && !cpp_get_options (pfile)->preprocessed)
+    /* Only directives matter for dependency generation and -dM, so
+       there is no need to lex the rest of the text.  */
+    cpp_directive_only_process (pfile, NULL, directives_only_nooutput_cb);
+  else if (flag_no_output && pfile->buffer)
     {
       /* Scan -included buffers, then the main file.  */
       while (pfile->buffer->prev)
@@ -419,6 +427,15 @@ directives_only_cb (cpp_reader *pfile, CPP_DO_task task, void *data_, ...)
   va_end (args);
 }
 
+/* Like directives_only_cb, but for when output is suppressed.  */
+
+static void
+directives_only_nooutput_cb (cpp_reader *, CPP_DO_task task, void *, ...)
+{
+  gcc_checking_assert (task == CPP_DO_print || task == CPP_DO_location
+		       || task == CPP_DO_token);
+}
+
 /* Writes out the preprocessed file, handling spacing and paste
    avoidance issues.  */
 static void
@@ -1916,7 +1916,8 @@ cgraph_node::expand (void)
 }
 
 /* Node comparator that is responsible for the order that corresponds
-   to time when a function was launched for the first time.  */
+   to time when a function was launched for the first time.  Functions
+   placed by call-chain clustering come first, in the computed order.  */
 
 int
 tp_first_run_node_cmp (const void *pa, const void *pb)
@@ -1926,6 +1927,15 @@ tp_first_run_node_cmp (const void *pa, const void *pb)
   unsigned int tp_first_run_a = a->tp_first_run;
   unsigned int tp_first_run_b = b->tp_first_run;
 
+  if (a->text_sorted_order != b->text_sorted_order)
+    {
+      if (!a->text_sorted_order)
+	return 1;
+      if (!b->text_sorted_order)
+	return -1;
+      return a->text_sorted_order < b->text_sorted_order ? -1 : 1;
+    }
+
   if (!opt_for_fn (a->decl, flag_profile_reorder_functions)
       || a->no_reorder)
     tp_first_run_a = 0;
@@ -1973,14 +1983,17 @@ expand_all_functions (void)
   for (i = 0; i < order_pos; i++)
     if (order[i]->process)
       {
-	if (order[i]->tp_first_run
-	    && opt_for_fn (order[i]->decl, flag_profile_reorder_functions))
+	if (order[i]->text_sorted_order
+	    || (order[i]->tp_first_run
+		&& opt_for_fn (order[i]->decl,
+			       flag_profile_reorder_functions)))
 	  tp_first_run_order[tp_first_run_order_pos++] = order[i];
 	else
           order[new_order_pos++] = order[i];
       }
 
-  /* First output functions with time profile in specified order.  */
+  /* First output functions placed by call-chain clustering and then
+     functions with time profile in specified order.  */
   qsort (tp_first_run_order, tp_first_run_order_pos,
 	 sizeof (cgraph_node *), tp_first_run_node_cmp);
   for (i = 0; i < tp_first_run_order_pos; i++)
@@ -1992,7 +2005,12 @@ expand_all_functions (void)
 	  expanded_func_count++;
 	  profiled_func_count++;
 
-	  if (symtab->dump_file)
+	  if (symtab->dump_file && node->text_sorted_order)
+	    fprintf (symtab->dump_file,
+		     "Call-chain clustering order in "
+		     "expand_all_functions:%s:%u\n",
+		     node->dump_asm_name (), node->text_sorted_order);
+	  else if (symtab->dump_file)
 	    fprintf (symtab->dump_file,
 		     "Time profile order in expand_all_functions:%s:%d\n",
 		     node->dump_asm_name (), node->tp_first_run);
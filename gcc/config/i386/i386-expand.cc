@@ -4916,6 +4916,41 @@ ix86_expand_int_vec_cmp (rtx operands[])
   return true;
 }
 
+/* Expand a WHILE_ULT operation.  Bit I of the AVX-512 mask OPERANDS[0] is
+   set if I is less than the number of elements OPERANDS[3] and OPERANDS[1]
+   + I is less than OPERANDS[2].  */
+
+void
+ix86_expand_while_ult (rtx operands[])
+{
+  machine_mode mask_mode = GET_MODE (operands[0]);
+  machine_mode mode = GET_MODE (operands[1]);
+  unsigned HOST_WIDE_INT nunits = UINTVAL (operands[3]);
+
+  gcc_assert (nunits <= GET_MODE_BITSIZE (mask_mode));
+
+  /* The number of active elements is
+     MIN (MAX (OPERANDS[2], OPERANDS[1]) - OPERANDS[1], NUNITS).  */
+  rtx n = expand_simple_binop (mode, UMAX, operands[2], operands[1],
+			       NULL_RTX, 1, OPTAB_DIRECT);
+  n = expand_simple_binop (mode, MINUS, n, operands[1],
+			   NULL_RTX, 1, OPTAB_DIRECT);
+  n = expand_simple_binop (mode, UMIN, n, GEN_INT (nunits),
+			   NULL_RTX, 1, OPTAB_DIRECT);
+
+  /* Clear the bits of an all-ones value from bit N upwards.  */
+  machine_mode bzhi_mode = nunits > 32 ? DImode : SImode;
+  n = force_reg (bzhi_mode, convert_to_mode (bzhi_mode, n, 1));
+  rtx ones = force_reg (bzhi_mode, constm1_rtx);
+  rtx res = gen_reg_rtx (bzhi_mode);
+  if (bzhi_mode == DImode)
+    emit_insn (gen_bmi2_bzhi_di3 (res, ones, n));
+  else
+    emit_insn (gen_bmi2_bzhi_si3 (res, ones, n));
+
+  emit_move_insn (operands[0], gen_lowpart (mask_mode, res));
+}
+
 /* Expand a floating-point vector conditional move; a vcond operation
    rather than a movcc operation.  */
 
@@ -3000,8 +3000,16 @@ ix86_option_override_internal (bool main_args_p,
 
   /* Fully masking the main or the epilogue vectorized loop is not
      profitable generally so leave it disabled until we get more
-     fine grained control & costing.  */
-  SET_OPTION_IF_UNSET (opts, opts_set, param_vect_partial_vector_usage, 0);
+     fine grained control & costing.  With AVX512 the loop masks are
+     cheap to compute, so with X86_TUNE_AVX512_MASKED_EPILOGUES mask the
+     epilogue, and the main loop when it has fewer iterations than the
+     vectorization factor.  */
+  if (TARGET_AVX512F_P (opts->x_ix86_isa_flags)
+      && TARGET_BMI2_P (opts->x_ix86_isa_flags)
+      && ix86_tune_features [X86_TUNE_AVX512_MASKED_EPILOGUES])
+    SET_OPTION_IF_UNSET (opts, opts_set, param_vect_partial_vector_usage, 1);
+  else
+    SET_OPTION_IF_UNSET (opts, opts_set, param_vect_partial_vector_usage, 0);
 
   return true;
 }
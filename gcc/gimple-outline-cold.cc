@@ -0,0 +1,698 @@
+/* Outlining of cold paths ending in noreturn calls.
+   Copyright (C) 2023 Free Software Foundation, Inc.
+
+This file is part of GCC.
+
+GCC is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free
+Software Foundation; either version 3, or (at your option) any later
+version.
+
+GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or
+FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received a copy of the GNU General Public License
+along with GCC; see the file COPYING3.  If not see
+<http://www.gnu.org/licenses/>.  */
+
+/* Code leading to a call of a noreturn function, such as abort, one of the
+   C++ __throw_* helpers or a language runtime's panic function, is executed
+   at most once per failure and mostly sets up the arguments of that call.
+   When it sits in a hot function it still makes the function bigger, both
+   in the eyes of the inliner and in the instruction cache.
+
+   This pass moves such code into a new artificial function and replaces it
+   by a single call.  For example
+
+     <bb 5> :
+       f.file = "vec.c";
+       f.line = 12;
+       f.index = i_2(D);
+       _7 = n_3(D) + -1;
+       out_of_range (&f, _7);
+
+   becomes
+
+     <bb 5> :
+       get.outlined.0 (i_2(D), n_3(D));
+
+   The new functions are static, noreturn, cold and never inlined.  Only the
+   values computed outside of the outlined code are passed to them, so the
+   same failure path appearing in several functions, typically through
+   inlined copies of the same check, produces identical functions that are
+   later merged by identical code folding.
+
+   Only basic blocks without successors are considered.  They may use SSA
+   names defined elsewhere and local variables that are not referenced
+   from any other basic block; such variables are moved to the new
+   function.  The new function is built as GENERIC and goes through the
+   early optimizations of its own once the current IPA pass finishes.  */
+
+#include "config.h"
+#include "system.h"
+#include "coretypes.h"
+#include "backend.h"
+#include "tree.h"
+#include "gimple.h"
+#include "tree-pass.h"
+#include "ssa.h"
+#include "cgraph.h"
+#include "fold-const.h"
+#include "calls.h"
+#include "predict.h"
+#include "tree-eh.h"
+#include "gimple-iterator.h"
+#include "gimple-walk.h"
+#include "gimplify.h"
+#include "tree-cfg.h"
+#include "tree-iterator.h"
+#include "tree-inline.h"
+#include "cfgexpand.h"
+#include "attribs.h"
+
+/* Local variables of the current function, mapped to the index of the only
+   basic block referencing them, or to -1 if they are referenced from more
+   than one basic block.  */
+
+typedef hash_map<tree, int> local_var_bbs;
+
+/* Data passed to note_local_var_use.  */
+
+struct note_local_var_data
+{
+  local_var_bbs *bbs;
+  int bb_index;
+};
+
+/* Callback for walk_tree.  Record in DATA that the local variable *TP is
+   referenced from the current basic block.  */
+
+static tree
+note_local_var_use (tree *tp, int *walk_subtrees, void *data)
+{
+  note_local_var_data *d = (note_local_var_data *) data;
+  tree t = *tp;
+
+  if (VAR_P (t) && auto_var_in_fn_p (t, current_function_decl))
+    {
+      bool existed;
+      int &index = d->bbs->get_or_insert (t, &existed);
+      if (!existed)
+	index = d->bb_index;
+      else if (index != d->bb_index)
+	index = -1;
+    }
+  if (IS_TYPE_OR_DECL_P (t) || TREE_CODE (t) == SSA_NAME)
+    *walk_subtrees = 0;
+  return NULL_TREE;
+}
+
+/* Callback for walk_gimple_op, wrapping note_local_var_use.  */
+
+static tree
+note_local_var_use_in_stmt (tree *tp, int *walk_subtrees, void *data)
+{
+  walk_stmt_info *wi = (walk_stmt_info *) data;
+  return note_local_var_use (tp, walk_subtrees, wi->info);
+}
+
+/* Compute the basic block referencing each local variable of the current
+   function into BBS.  Debug statements are ignored so that the same code
+   is outlined with and without -g; the debug bind statements referring to
+   variables that are moved away are reset afterwards.  */
+
+static void
+compute_local_var_bbs (local_var_bbs *bbs)
+{
+  basic_block bb;
+  note_local_var_data d;
+  d.bbs = bbs;
+
+  FOR_EACH_BB_FN (bb, cfun)
+    {
+      d.bb_index = bb->index;
+      for (gphi_iterator gsi = gsi_start_phis (bb); !gsi_end_p (gsi);
+	   gsi_next (&gsi))
+	{
+	  gphi *phi = gsi.phi ();
+	  for (unsigned i = 0; i < gimple_phi_num_args (phi); i++)
+	    walk_tree (gimple_phi_arg_def_ptr (phi, i), note_local_var_use,
+		       &d, NULL);
+	}
+      for (gimple_stmt_iterator gsi = gsi_start_nondebug_bb (bb);
+	   !gsi_end_p (gsi); gsi_next_nondebug (&gsi))
+	{
+	  walk_stmt_info wi;
+	  memset (&wi, 0, sizeof (wi));
+	  wi.info = &d;
+	  walk_gimple_op (gsi_stmt (gsi), note_local_var_use_in_stmt, &wi);
+	}
+    }
+}
+
+/* Callback for walk_tree.  Return *TP if it is one of the variables in
+   the set passed in DATA.  */
+
+static tree
+find_moved_var (tree *tp, int *walk_subtrees, void *data)
+{
+  hash_set<tree> *moved = (hash_set<tree> *) data;
+
+  if (moved->contains (*tp))
+    return *tp;
+  if (IS_TYPE_OR_DECL_P (*tp) || TREE_CODE (*tp) == SSA_NAME)
+    *walk_subtrees = 0;
+  return NULL_TREE;
+}
+
+/* Reset the debug bind statements of the current function whose value
+   refers to one of the local variables in MOVED, which now belong to
+   another function, and remove those binding them.  */
+
+static void
+reset_debug_uses_of_moved_vars (hash_set<tree> *moved)
+{
+  basic_block bb;
+  FOR_EACH_BB_FN (bb, cfun)
+    {
+      gimple_stmt_iterator gsi = gsi_start_bb (bb);
+      while (!gsi_end_p (gsi))
+	{
+	  gimple *stmt = gsi_stmt (gsi);
+	  if (!gimple_debug_bind_p (stmt))
+	    {
+	      gsi_next (&gsi);
+	      continue;
+	    }
+
+	  if (moved->contains (gimple_debug_bind_get_var (stmt)))
+	    {
+	      gsi_remove (&gsi, true);
+	      continue;
+	    }
+
+	  if (gimple_debug_bind_has_value_p (stmt)
+	      && walk_tree (gimple_debug_bind_get_value_ptr (stmt),
+			    find_moved_var, moved, NULL))
+	    {
+	      gimple_debug_bind_reset_value (stmt);
+	      update_stmt (stmt);
+	    }
+	  gsi_next (&gsi);
+	}
+    }
+}
+
+/* Description of a basic block being outlined.  */
+
+class cold_region
+{
+public:
+  cold_region (basic_block bb) : bb (bb), inputs (), locals () {}
+
+  /* The basic block.  */
+  basic_block bb;
+
+  /* SSA names used by the block but not defined by its statements, in the
+     order of their first use.  These become the parameters of the new
+     function.  */
+  auto_vec<tree> inputs;
+
+  /* Local variables referenced only by the block.  */
+  auto_vec<tree> locals;
+};
+
+/* Data passed to check_outlined_operand.  */
+
+struct check_operand_data
+{
+  cold_region *region;
+  local_var_bbs *bbs;
+  hash_set<tree> *seen;
+};
+
+/* Callback for walk_gimple_op.  Record the inputs and local variables
+   referenced by the operand *TP of a statement of the region passed in
+   DATA, and return *TP if it cannot be moved to another function.  */
+
+static tree
+check_outlined_operand (tree *tp, int *walk_subtrees, void *data)
+{
+  walk_stmt_info *wi = (walk_stmt_info *) data;
+  check_operand_data *d = (check_operand_data *) wi->info;
+  cold_region *region = d->region;
+  tree t = *tp;
+
+  if (TREE_CODE (t) == SSA_NAME)
+    {
+      *walk_subtrees = 0;
+      if (SSA_NAME_OCCURS_IN_ABNORMAL_PHI (t)
+	  || variably_modified_type_p (TREE_TYPE (t), NULL_TREE))
+	return t;
+      gimple *def = SSA_NAME_DEF_STMT (t);
+      if ((SSA_NAME_IS_DEFAULT_DEF (t)
+	   || gimple_bb (def) != region->bb
+	   || gimple_code (def) == GIMPLE_PHI)
+	  && !d->seen->add (t))
+	region->inputs.safe_push (t);
+      return NULL_TREE;
+    }
+
+  if (TREE_CODE (t) == LABEL_DECL)
+    return t;
+
+  if (DECL_P (t) && auto_var_in_fn_p (t, current_function_decl))
+    {
+      *walk_subtrees = 0;
+      /* Parameters and the result are only usable through SSA names.  */
+      if (!VAR_P (t)
+	  || DECL_HAS_VALUE_EXPR_P (t)
+	  || DECL_NONLOCAL (t)
+	  || !DECL_SIZE (t)
+	  || TREE_CODE (DECL_SIZE (t)) != INTEGER_CST
+	  || variably_modified_type_p (TREE_TYPE (t), NULL_TREE))
+	return t;
+      int *index = d->bbs->get (t);
+      if (!index || *index != region->bb->index)
+	return t;
+      if (!d->seen->add (t))
+	region->locals.safe_push (t);
+      return NULL_TREE;
+    }
+
+  if (IS_TYPE_OR_DECL_P (t))
+    *walk_subtrees = 0;
+  return NULL_TREE;
+}
+
+/* Return true if STMT can be moved to another function.  */
+
+static bool
+outlinable_stmt_p (gimple *stmt)
+{
+  /* Statements that may throw are fine as long as the exception leaves
+     the function; moving them out of an EH region, including a
+     must-not-throw one, would change what happens to it.  */
+  if (lookup_stmt_eh_lp (stmt) != 0)
+    return false;
+
+  switch (gimple_code (stmt))
+    {
+    case GIMPLE_DEBUG:
+    case GIMPLE_PREDICT:
+    case GIMPLE_NOP:
+    case GIMPLE_ASSIGN:
+      return true;
+
+    case GIMPLE_LABEL:
+      {
+	tree label = gimple_label_label (as_a <glabel *> (stmt));
+	return !FORCED_LABEL (label) && !DECL_NONLOCAL (label);
+      }
+
+    case GIMPLE_CALL:
+      {
+	gcall *call = as_a <gcall *> (stmt);
+	if (gimple_call_internal_p (call)
+	    || gimple_call_chain (call)
+	    || gimple_call_va_arg_pack_p (call)
+	    || (gimple_call_flags (call)
+		& (ECF_RETURNS_TWICE | ECF_MAY_BE_ALLOCA)))
+	  return false;
+
+	/* Builtins whose result depends on the frame they are called in.  */
+	tree fndecl = gimple_call_fndecl (call);
+	if (fndecl && fndecl_built_in_p (fndecl, BUILT_IN_NORMAL))
+	  switch (DECL_FUNCTION_CODE (fndecl))
+	    {
+	    case BUILT_IN_RETURN_ADDRESS:
+	    case BUILT_IN_FRAME_ADDRESS:
+	    case BUILT_IN_DWARF_CFA:
+	    case BUILT_IN_VA_START:
+	    case BUILT_IN_VA_END:
+	    case BUILT_IN_VA_COPY:
+	    case BUILT_IN_NEXT_ARG:
+	    case BUILT_IN_APPLY_ARGS:
+	    case BUILT_IN_EH_POINTER:
+	    case BUILT_IN_EH_FILTER:
+	    case BUILT_IN_EH_COPY_VALUES:
+	    case BUILT_IN_UNWIND_RESUME:
+	    case BUILT_IN_STACK_SAVE:
+	    case BUILT_IN_STACK_RESTORE:
+	    case BUILT_IN_UNREACHABLE:
+	    case BUILT_IN_UNREACHABLE_TRAP:
+	    case BUILT_IN_TRAP:
+	      return false;
+	    default:
+	      break;
+	    }
+	return true;
+      }
+
+    default:
+      return false;
+    }
+}
+
+/* If BB is a cold basic block ending in a call to a noreturn function that
+   is worth outlining, fill REGION with what the new function needs and
+   return true.  BBS describes the uses of local variables.  */
+
+static bool
+analyze_cold_region (cold_region *region, local_var_bbs *bbs)
+{
+  basic_block bb = region->bb;
+
+  if (EDGE_COUNT (bb->succs) != 0
+      || bb_has_eh_pred (bb)
+      || bb_has_abnormal_pred (bb)
+      || (profile_status_for_fn (cfun) == PROFILE_READ
+	  && maybe_hot_bb_p (cfun, bb)))
+    return false;
+
+  gcall *last = safe_dyn_cast <gcall *> (last_stmt (bb));
+  if (!last
+      || !gimple_call_noreturn_p (last)
+      || !gimple_vuse (last))
+    return false;
+
+  hash_set<tree> seen;
+  check_operand_data d = { region, bbs, &seen };
+  int size = 0;
+
+  for (gimple_stmt_iterator gsi = gsi_start_bb (bb); !gsi_end_p (gsi);
+       gsi_next (&gsi))
+    {
+      gimple *stmt = gsi_stmt (gsi);
+      if (!outlinable_stmt_p (stmt))
+	return false;
+      if (!is_gimple_assign (stmt) && !is_gimple_call (stmt))
+	continue;
+
+      walk_stmt_info wi;
+      memset (&wi, 0, sizeof (wi));
+      wi.info = &d;
+      if (walk_gimple_op (stmt, check_outlined_operand, &wi))
+	return false;
+      size += estimate_num_insns (stmt, &eni_size_weights);
+    }
+
+  int call_size = eni_size_weights.call_cost;
+  for (tree input : region->inputs)
+    call_size += estimate_move_cost (TREE_TYPE (input), false);
+
+  if (dump_file && (dump_flags & TDF_DETAILS))
+    fprintf (dump_file, "bb %i: size %i, call size %i, %u inputs\n",
+	     bb->index, size, call_size, region->inputs.length ());
+
+  return size - call_size >= param_outline_cold_paths_min_savings;
+}
+
+/* Callback for walk_tree.  Replace SSA names and local variables by their
+   counterparts in the new function, as given by the map in DATA.  */
+
+static tree
+remap_outlined_operand (tree *tp, int *walk_subtrees, void *data)
+{
+  hash_map<tree, tree> *map = (hash_map<tree, tree> *) data;
+
+  if (tree *repl = map->get (*tp))
+    {
+      *tp = *repl;
+      *walk_subtrees = 0;
+    }
+  else if (IS_TYPE_OR_DECL_P (*tp) || TREE_CODE (*tp) == SSA_NAME)
+    *walk_subtrees = 0;
+  return NULL_TREE;
+}
+
+/* Return a GENERIC copy of OP for the new function, using MAP to replace
+   SSA names and local variables.  */
+
+static tree
+outlined_operand (tree op, hash_map<tree, tree> *map)
+{
+  op = unshare_expr (op);
+  walk_tree (&op, remap_outlined_operand, map, NULL);
+  return op;
+}
+
+/* Return a GENERIC statement doing what STMT does, for the new function.  */
+
+static tree
+outlined_stmt (gimple *stmt, hash_map<tree, tree> *map)
+{
+  location_t loc = gimple_location (stmt);
+  tree lhs = gimple_get_lhs (stmt);
+  tree expr;
+
+  if (is_gimple_assign (stmt))
+    expr = outlined_operand (gimple_assign_rhs_to_tree (stmt), map);
+  else
+    {
+      gcall *call = as_a <gcall *> (stmt);
+      tree fn = outlined_operand (gimple_call_fn (call), map);
+      tree fntype = gimple_call_fntype (call);
+
+      /* Preserve the type the function is called with.  */
+      if (TREE_TYPE (TREE_TYPE (fn)) != fntype)
+	fn = build1 (NOP_EXPR, build_pointer_type (fntype), fn);
+
+      auto_vec<tree, 8> args (gimple_call_num_args (call));
+      for (unsigned i = 0; i < gimple_call_num_args (call); i++)
+	args.quick_push (outlined_operand (gimple_call_arg (call, i), map));
+      expr = build_call_array_loc (loc, gimple_call_return_type (call), fn,
+				   args.length (), args.address ());
+      CALL_EXPR_RETURN_SLOT_OPT (expr) = gimple_call_return_slot_opt_p (call);
+    }
+
+  if (lhs)
+    {
+      lhs = outlined_operand (lhs, map);
+      expr = build2_loc (loc, MODIFY_EXPR, TREE_TYPE (lhs), lhs, expr);
+    }
+  return expr;
+}
+
+/* Move the statements of REGION into a new function and replace them by a
+   call to it.  */
+
+static void
+outline_cold_region (cold_region *region)
+{
+  basic_block bb = region->bb;
+  gimple *last = last_stmt (bb);
+  location_t loc = gimple_location (last);
+  hash_map<tree, tree> map;
+  bool nothrow = true;
+
+  tree name = clone_function_name_numbered (current_function_decl,
+					    "outlined");
+  auto_vec<tree, 8> arg_types (region->inputs.length ());
+  for (tree input : region->inputs)
+    arg_types.quick_push (TREE_TYPE (input));
+  tree fntype = build_function_type_array (void_type_node,
+					   arg_types.length (),
+					   arg_types.address ());
+  tree decl = build_decl (loc, FUNCTION_DECL, name, fntype);
+  SET_DECL_ASSEMBLER_NAME (decl, name);
+
+  tree resdecl = build_decl (loc, RESULT_DECL, NULL_TREE, void_type_node);
+  DECL_ARTIFICIAL (resdecl) = 1;
+  DECL_IGNORED_P (resdecl) = 1;
+  DECL_CONTEXT (resdecl) = decl;
+  DECL_RESULT (decl) = resdecl;
+
+  tree parms = NULL_TREE;
+  for (int i = region->inputs.length () - 1; i >= 0; i--)
+    {
+      tree input = region->inputs[i];
+      tree parm = build_decl (loc, PARM_DECL, NULL_TREE, TREE_TYPE (input));
+      DECL_ARTIFICIAL (parm) = 1;
+      DECL_ARG_TYPE (parm) = TREE_TYPE (input);
+      DECL_CONTEXT (parm) = decl;
+      DECL_CHAIN (parm) = parms;
+      parms = parm;
+      map.put (input, parm);
+    }
+  DECL_ARGUMENTS (decl) = parms;
+
+  tree vars = NULL_TREE;
+  for (tree var : region->locals)
+    {
+      tree copy = copy_node (var);
+      DECL_CONTEXT (copy) = decl;
+      DECL_INITIAL (copy) = NULL_TREE;
+      DECL_CHAIN (copy) = vars;
+      vars = copy;
+      map.put (var, copy);
+    }
+
+  /* SSA names defined by the block become local variables.  */
+  tree body = NULL_TREE;
+  for (gimple_stmt_iterator gsi = gsi_start_bb (bb); !gsi_end_p (gsi);
+       gsi_next (&gsi))
+    {
+      gimple *stmt = gsi_stmt (gsi);
+      if (!is_gimple_assign (stmt) && !is_gimple_call (stmt))
+	continue;
+
+      tree lhs = gimple_get_lhs (stmt);
+      if (lhs && TREE_CODE (lhs) == SSA_NAME)
+	{
+	  tree var = build_decl (gimple_location (stmt), VAR_DECL, NULL_TREE,
+				 TREE_TYPE (lhs));
+	  DECL_ARTIFICIAL (var) = 1;
+	  DECL_IGNORED_P (var) = 1;
+	  DECL_CONTEXT (var) = decl;
+	  DECL_CHAIN (var) = vars;
+	  vars = var;
+	  map.put (lhs, var);
+	}
+      if (stmt_could_throw_p (cfun, stmt))
+	nothrow = false;
+      append_to_statement_list_force (outlined_stmt (stmt, &map), &body);
+    }
+
+  tree block = make_node (BLOCK);
+  BLOCK_SUPERCONTEXT (block) = decl;
+  BLOCK_VARS (block) = vars;
+  TREE_USED (block) = 1;
+  DECL_INITIAL (decl) = block;
+  DECL_SAVED_TREE (decl) = build3 (BIND_EXPR, void_type_node, vars, body,
+				   block);
+
+  TREE_STATIC (decl) = 1;
+  TREE_USED (decl) = 1;
+  TREE_THIS_VOLATILE (decl) = 1;
+  TREE_NOTHROW (decl) = nothrow;
+  DECL_ARTIFICIAL (decl) = 1;
+  DECL_UNINLINABLE (decl) = 1;
+  DECL_NO_INSTRUMENT_FUNCTION_ENTRY_EXIT (decl)
+    = DECL_NO_INSTRUMENT_FUNCTION_ENTRY_EXIT (current_function_decl);
+  DECL_FUNCTION_SPECIFIC_OPTIMIZATION (decl)
+    = DECL_FUNCTION_SPECIFIC_OPTIMIZATION (current_function_decl);
+  DECL_FUNCTION_SPECIFIC_TARGET (decl)
+    = DECL_FUNCTION_SPECIFIC_TARGET (current_function_decl);
+  DECL_ATTRIBUTES (decl) = tree_cons (get_identifier ("cold"), NULL_TREE,
+				      NULL_TREE);
+
+  push_struct_function (decl);
+  cfun->function_end_locus = loc;
+  pop_cfun ();
+  gimplify_function_tree (decl);
+  cgraph_node::add_new_function (decl, false);
+
+  /* Unlike most functions added late, this one is only called directly
+     and may be merged with others or removed.  */
+  cgraph_node *node = cgraph_node::get (decl);
+  node->force_output = false;
+  node->local = true;
+
+  if (dump_file)
+    fprintf (dump_file, "Outlining bb %i into %s\n", bb->index,
+	     IDENTIFIER_POINTER (name));
+
+  /* Replace the statements by the call.  */
+  tree vuse = NULL_TREE;
+  gimple_stmt_iterator gsi = gsi_after_labels (bb);
+  while (!gsi_end_p (gsi))
+    {
+      gimple *stmt = gsi_stmt (gsi);
+      if (!vuse)
+	vuse = gimple_vuse (stmt);
+      unlink_stmt_vdef (stmt);
+      gsi_remove (&gsi, true);
+      release_defs (stmt);
+    }
+
+  gcall *call = gimple_build_call_vec (decl, region->inputs);
+  gimple_set_location (call, loc);
+  gimple_call_set_ctrl_altering (call, true);
+  gimple_set_vuse (call, vuse);
+  gimple_set_vdef (call, make_ssa_name (gimple_vop (cfun), call));
+  gsi_insert_before (&gsi, call, GSI_NEW_STMT);
+}
+
+/* Execute the cold path outlining pass.  */
+
+static unsigned int
+execute_outline_cold_paths (void)
+{
+  cgraph_node *node = cgraph_node::get (current_function_decl);
+
+  /* Outlining from code that is cold as a whole would only add calls.  */
+  if ((flags_from_decl_or_type (current_function_decl) & ECF_NORETURN)
+      || node->frequency == NODE_FREQUENCY_UNLIKELY_EXECUTED
+      || cfun->calls_setjmp
+      || cfun->has_nonlocal_label)
+    return 0;
+
+  local_var_bbs bbs;
+  compute_local_var_bbs (&bbs);
+
+  auto_delete_vec<cold_region> regions;
+  basic_block bb;
+  FOR_EACH_BB_FN (bb, cfun)
+    {
+      cold_region *region = new cold_region (bb);
+      if (analyze_cold_region (region, &bbs))
+	regions.safe_push (region);
+      else
+	delete region;
+    }
+
+  hash_set<tree> moved;
+  for (cold_region *region : regions)
+    {
+      outline_cold_region (region);
+      for (tree var : region->locals)
+	moved.add (var);
+    }
+
+  if (MAY_HAVE_DEBUG_BIND_STMTS && !moved.is_empty ())
+    reset_debug_uses_of_moved_vars (&moved);
+
+  return regions.is_empty () ? 0 : TODO_remove_unused_locals;
+}
+
+namespace {
+
+const pass_data pass_data_outline_cold_paths =
+{
+  GIMPLE_PASS, /* type */
+  "coldoutline", /* name */
+  OPTGROUP_NONE, /* optinfo_flags */
+  TV_TREE_OUTLINE_COLD, /* tv_id */
+  ( PROP_cfg | PROP_ssa ), /* properties_required */
+  0, /* properties_provided */
+  0, /* properties_destroyed */
+  0, /* todo_flags_start */
+  0, /* todo_flags_finish */
+};
+
+class pass_outline_cold_paths : public gimple_opt_pass
+{
+public:
+  pass_outline_cold_paths (gcc::context *ctxt)
+    : gimple_opt_pass (pass_data_outline_cold_paths, ctxt)
+  {}
+
+  /* opt_pass methods: */
+  bool gate (function *) final override { return flag_outline_cold_paths; }
+  unsigned int execute (function *) final override
+    {
+      return execute_outline_cold_paths ();
+    }
+
+}; // class pass_outline_cold_paths
+
+} // anon namespace
+
+gimple_opt_pass *
+make_pass_outline_cold_paths (gcc::context *ctxt)
+{
+  return new pass_outline_cold_paths (ctxt);
+}
@@ -59,7 +59,8 @@ func_checker::func_checker (tree source_func_decl, tree target_func_decl,
   : m_source_func_decl (source_func_decl), m_target_func_decl (target_func_decl),
     m_ignored_source_nodes (ignored_source_nodes),
     m_ignored_target_nodes (ignored_target_nodes),
-    m_ignore_labels (ignore_labels), m_tbaa (tbaa)
+    m_ignore_labels (ignore_labels), m_tbaa (tbaa),
+    m_relaxed_types (relaxed_types_p (source_func_decl, target_func_decl))
 {
   function *source_func = DECL_STRUCT_FUNCTION (source_func_decl);
   function *target_func = DECL_STRUCT_FUNCTION (target_func_decl);
@@ -162,7 +163,8 @@ func_checker::compare_decl (const_tree t1, const_tree t2)
      (parm decls and result decl types may affect ABI convetions).  */
   if (t != VAR_DECL)
     {
-      if (!compatible_types_p (TREE_TYPE (t1), TREE_TYPE (t2)))
+      if (!compatible_types_p (TREE_TYPE (t1), TREE_TYPE (t2),
+			       m_relaxed_types))
 	return return_false ();
     }
   else
@@ -214,9 +216,100 @@ func_checker::compatible_polymorphic_types_p (tree t1, tree t2,
   return true;
 }
 
-/* Return true if types are compatible from perspective of ICF.  */
+/* Return true if aggregate types T1 and T2 have the same layout: they
+   consist of compatible scalars at the same positions.  Such types are
+   passed and accessed the same way, so that with -fipa-icf-relaxed-types
+   bodies differing only in which of them they use are merged.  Memory
+   accesses are still compared separately, including their alias sets.  */
+
+static bool
+same_layout_types_p (tree t1, tree t2)
+{
+  if (TREE_CODE (t1) != TREE_CODE (t2)
+      || TYPE_MODE (t1) != TYPE_MODE (t2)
+      || TYPE_ALIGN (t1) != TYPE_ALIGN (t2)
+      || !operand_equal_p (TYPE_SIZE (t1), TYPE_SIZE (t2), 0))
+    return false;
+
+  switch (TREE_CODE (t1))
+    {
+    case RECORD_TYPE:
+    case UNION_TYPE:
+    case QUAL_UNION_TYPE:
+      {
+	if (TYPE_REVERSE_STORAGE_ORDER (t1) != TYPE_REVERSE_STORAGE_ORDER (t2)
+	    || TYPE_TRANSPARENT_AGGR (t1) != TYPE_TRANSPARENT_AGGR (t2))
+	  return false;
+
+	tree f1 = TYPE_FIELDS (t1);
+	tree f2 = TYPE_FIELDS (t2);
+	while (true)
+	  {
+	    while (f1 && TREE_CODE (f1) != FIELD_DECL)
+	      f1 = DECL_CHAIN (f1);
+	    while (f2 && TREE_CODE (f2) != FIELD_DECL)
+	      f2 = DECL_CHAIN (f2);
+	    if (!f1 || !f2)
+	      return f1 == f2;
+
+	    if (DECL_BIT_FIELD (f1) != DECL_BIT_FIELD (f2)
+		|| !operand_equal_p (DECL_FIELD_OFFSET (f1),
+				     DECL_FIELD_OFFSET (f2), 0)
+		|| !operand_equal_p (DECL_FIELD_BIT_OFFSET (f1),
+				     DECL_FIELD_BIT_OFFSET (f2), 0)
+		|| !operand_equal_p (DECL_SIZE (f1), DECL_SIZE (f2), 0)
+		|| !func_checker::relaxed_compatible_types_p (TREE_TYPE (f1),
+							      TREE_TYPE (f2),
+							      true))
+	      return false;
+
+	    f1 = DECL_CHAIN (f1);
+	    f2 = DECL_CHAIN (f2);
+	  }
+      }
+
+    case ARRAY_TYPE:
+      return (TYPE_NONALIASED_COMPONENT (t1) == TYPE_NONALIASED_COMPONENT (t2)
+	      && func_checker::relaxed_compatible_types_p (TREE_TYPE (t1),
+							   TREE_TYPE (t2),
+							   true));
+
+    default:
+      return false;
+    }
+}
+
+/* Return true if types T1 and T2 are compatible or, if RELAXED, are
+   aggregates of the same layout.  */
+
+bool
+func_checker::relaxed_compatible_types_p (tree t1, tree t2, bool relaxed)
+{
+  if (types_compatible_p (t1, t2))
+    return true;
+
+  return (relaxed
+	  && AGGREGATE_TYPE_P (t1)
+	  && AGGREGATE_TYPE_P (t2)
+	  && COMPLETE_TYPE_P (t1)
+	  && COMPLETE_TYPE_P (t2)
+	  && same_layout_types_p (t1, t2));
+}
+
+/* Return true if -fipa-icf-relaxed-types is enabled for both functions
+   DECL1 and DECL2.  */
+
+bool
+func_checker::relaxed_types_p (tree decl1, tree decl2)
+{
+  return (opt_for_fn (decl1, flag_ipa_icf_relaxed_types)
+	  && opt_for_fn (decl2, flag_ipa_icf_relaxed_types));
+}
+
+/* Return true if types are compatible from perspective of ICF.
+   If RELAXED, aggregates of the same layout are compatible too.  */
 bool
-func_checker::compatible_types_p (tree t1, tree t2)
+func_checker::compatible_types_p (tree t1, tree t2, bool relaxed)
 {
   if (TREE_CODE (t1) != TREE_CODE (t2))
     return return_false_with_msg ("different tree types");
@@ -224,7 +317,7 @@ func_checker::compatible_types_p (tree t1, tree t2)
   if (TYPE_RESTRICT (t1) != TYPE_RESTRICT (t2))
     return return_false_with_msg ("restrict flags are different");
 
-  if (!types_compatible_p (t1, t2))
+  if (!relaxed_compatible_types_p (t1, t2, relaxed))
     return return_false_with_msg ("types are not compatible");
 
   return true;
@@ -711,7 +804,7 @@ func_checker::compare_gimple_call (gcall *s1, gcall *s2)
   if (gimple_call_internal_p (s1)
       && t1
       && t2
-      && !compatible_types_p (TREE_TYPE (t1), TREE_TYPE (t2)))
+      && !compatible_types_p (TREE_TYPE (t1), TREE_TYPE (t2), m_relaxed_types))
     return return_false_with_msg ("GIMPLE internal call LHS type mismatch");
 
   return compare_operand (t1, t2, get_operand_access_type (&map, t1));
@@ -745,7 +838,8 @@ func_checker::compare_gimple_assign (gimple *s1, gimple *s2)
       /* Compare types for LHS.  */
       if (i == 0 && !gimple_store_p (s1))
 	{
-	  if (!compatible_types_p (TREE_TYPE (arg1), TREE_TYPE (arg2)))
+	  if (!compatible_types_p (TREE_TYPE (arg1), TREE_TYPE (arg2),
+				   m_relaxed_types))
 	    return return_false_with_msg ("GIMPLE LHS type mismatch");
 	}
 
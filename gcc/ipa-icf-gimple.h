@@ -125,7 +125,7 @@ public:
   func_checker ():
     m_source_func_decl (NULL_TREE), m_target_func_decl (NULL_TREE),
     m_ignored_source_nodes (NULL), m_ignored_target_nodes (NULL),
-    m_ignore_labels (false), m_tbaa (true)
+    m_ignore_labels (false), m_tbaa (true), m_relaxed_types (false)
   {
     m_source_ssa_names.create (0);
     m_target_ssa_names.create (0);
@@ -232,9 +232,16 @@ public:
 					      bool compare_ptr);
 
   /* Return true if types are compatible from perspective of ICF.
-     FIRST_ARGUMENT indicates if the comparison is called for
-     first parameter of a function.  */
-  static bool compatible_types_p (tree t1, tree t2);
+     If RELAXED, aggregates of the same layout are compatible too.  */
+  static bool compatible_types_p (tree t1, tree t2, bool relaxed = false);
+
+  /* Return true if types are compatible or, if RELAXED, have the same
+     layout.  */
+  static bool relaxed_compatible_types_p (tree t1, tree t2, bool relaxed);
+
+  /* Return true if -fipa-icf-relaxed-types is enabled for both functions
+     DECL1 and DECL2.  */
+  static bool relaxed_types_p (tree decl1, tree decl2);
 
   /* Compute hash map determining access types of operands.  */
   static void classify_operands (const gimple *stmt,
@@ -279,6 +286,10 @@ private:
   /* Flag if we should compare type based alias analysis info.  */
   bool m_tbaa;
 
+  /* Flag if types of the same layout are compatible, as
+     -fipa-icf-relaxed-types is enabled for both functions.  */
+  bool m_relaxed_types;
+
 public:
   /* Return true if two operands are equal.  The flags fields can be used
      to specify OEP flags described above.  */
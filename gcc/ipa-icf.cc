@@ -512,7 +512,9 @@ bool
 sem_function::compatible_parm_types_p (tree parm1, tree parm2)
 {
   /* Be sure that parameters are TBAA compatible.  */
-  if (!func_checker::compatible_types_p (parm1, parm2))
+  if (!func_checker::compatible_types_p
+	 (parm1, parm2,
+	  func_checker::relaxed_types_p (decl, m_compared_func->decl)))
     return return_false_with_msg ("parameter type is not compatible");
 
   if (POINTER_TYPE_P (parm1)
@@ -619,10 +621,13 @@ sem_function::equals_wpa (sem_item *item,
       return return_false_with_msg ("optimization flags are different");
     }
 
+  bool relaxed_types
+    = func_checker::relaxed_types_p (decl, m_compared_func->decl);
+
   /* Result type checking.  */
   if (!func_checker::compatible_types_p
 	 (TREE_TYPE (TREE_TYPE (decl)),
-	  TREE_TYPE (TREE_TYPE (m_compared_func->decl))))
+	  TREE_TYPE (TREE_TYPE (m_compared_func->decl)), relaxed_types))
     return return_false_with_msg ("result types are different");
 
   /* Checking types of arguments.  */
@@ -640,7 +645,8 @@ sem_function::equals_wpa (sem_item *item,
 
       /* Verify that types are compatible to ensure that both functions
 	 have same calling conventions.  */
-      if (!types_compatible_p (parm1, parm2))
+      if (!func_checker::relaxed_compatible_types_p (parm1, parm2,
+						     relaxed_types))
 	return return_false_with_msg ("parameter types are not compatible");
 
       if (!param_used_p (i))
@@ -862,7 +868,9 @@ sem_function::equals_private (sem_item *item)
   for (unsigned i = 0;
        arg1 && arg2; arg1 = DECL_CHAIN (arg1), arg2 = DECL_CHAIN (arg2), i++)
     {
-      if (!types_compatible_p (TREE_TYPE (arg1), TREE_TYPE (arg2)))
+      if (!func_checker::relaxed_compatible_types_p
+	     (TREE_TYPE (arg1), TREE_TYPE (arg2),
+	      func_checker::relaxed_types_p (decl, m_compared_func->decl)))
 	return return_false_with_msg ("argument types are not compatible");
       if (!param_used_p (i))
 	continue;
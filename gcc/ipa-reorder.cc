@@ -0,0 +1,284 @@
+/* Profile-guided function layout by call-chain clustering.
+   Copyright (C) 2023 Free Software Foundation, Inc.
+
+This file is part of GCC.
+
+GCC is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free
+Software Foundation; either version 3, or (at your option) any later
+version.
+
+GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+WARRANTY; without even the implied warranty of MERCHANTABILITY or
+FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received a copy of the GNU General Public License
+along with GCC; see the file COPYING3.  If not see
+<http://www.gnu.org/licenses/>.  */
+
+/* This pass implements the call-chain clustering (C3) function ordering
+   described in "Optimizing Function Placement for Large-Scale Data-Center
+   Applications" by Ottoni and Maher, CGO 2017.
+
+   Every function executed according to the profile starts in a cluster of
+   its own.  Functions are then visited from the hottest to the coldest and
+   the cluster of each is appended to the cluster of its most frequent
+   caller, unless the result would be larger than
+   --param reorder-functions-cluster-size or would be much less dense than
+   the caller's cluster.  Callees thus end up right after their callers.
+   Finally the clusters are sorted by decreasing density, the number of
+   executions per unit of size.
+
+   The resulting position is recorded in cgraph_node::text_sorted_order.
+   Functions are expanded in that order, and with LTO the same order is
+   used to assign functions to partitions, so that the layout also holds
+   across LTRANS units linked in partition order.  */
+
+#include "config.h"
+#include "system.h"
+#include "coretypes.h"
+#include "backend.h"
+#include "tree.h"
+#include "gimple.h"
+#include "alloc-pool.h"
+#include "tree-pass.h"
+#include "cgraph.h"
+#include "symbol-summary.h"
+#include "tree-vrp.h"
+#include "ipa-prop.h"
+#include "ipa-fnsummary.h"
+
+/* A merge is rejected if it would make the density of the caller's
+   cluster drop by more than this factor.  */
+#define MAX_DENSITY_DEGRADATION 8
+
+/* A group of functions to be laid out next to each other.  */
+
+class function_cluster
+{
+public:
+  function_cluster (cgraph_node *node, int size, gcov_type count)
+    : m_functions (), m_size (size), m_count (count)
+  {
+    m_functions.safe_push (node);
+  }
+
+  /* Number of executions per unit of size.  */
+  sreal density () const
+  {
+    return sreal (m_count) / sreal (m_size);
+  }
+
+  /* Functions in the cluster, in layout order.  */
+  auto_vec<cgraph_node *> m_functions;
+
+  /* Sum of the sizes of the functions.  */
+  int m_size;
+
+  /* Sum of the execution counts of the functions.  */
+  gcov_type m_count;
+};
+
+/* Sort clusters by decreasing execution count, breaking ties by the order
+   of their first function to keep the result stable.  */
+
+static int
+cluster_count_cmp (const void *pa, const void *pb)
+{
+  const function_cluster *a = *(const function_cluster * const *) pa;
+  const function_cluster *b = *(const function_cluster * const *) pb;
+
+  if (a->m_count != b->m_count)
+    return a->m_count > b->m_count ? -1 : 1;
+  return a->m_functions[0]->order - b->m_functions[0]->order;
+}
+
+/* Sort clusters by decreasing density, breaking ties by the order of their
+   first function to keep the result stable.  */
+
+static int
+cluster_density_cmp (const void *pa, const void *pb)
+{
+  const function_cluster *a = *(const function_cluster * const *) pa;
+  const function_cluster *b = *(const function_cluster * const *) pb;
+
+  sreal da = a->density ();
+  sreal db = b->density ();
+  if (da != db)
+    return da > db ? -1 : 1;
+  return a->m_functions[0]->order - b->m_functions[0]->order;
+}
+
+/* Return true if NODE should be placed by call-chain clustering.  */
+
+static bool
+clusterable_p (cgraph_node *node)
+{
+  return (!node->inlined_to
+	  && !node->no_reorder
+	  && node->has_gimple_body_p ()
+	  && opt_for_fn (node->decl, flag_reorder_functions)
+	  && (opt_for_fn (node->decl, flag_reorder_functions_algorithm)
+	      == REORDER_FUNCTIONS_ALGORITHM_CALL_CHAIN_CLUSTERING)
+	  && node->count.ipa ().nonzero_p ()
+	  && ipa_size_summaries
+	  && ipa_size_summaries->get (node));
+}
+
+/* Compute cgraph_node::text_sorted_order for all functions that were
+   executed according to the profile.  */
+
+static unsigned int
+ipa_reorder (void)
+{
+  cgraph_node *node;
+  auto_vec<function_cluster *> clusters;
+  hash_map<cgraph_node *, function_cluster *> cluster_of;
+
+  FOR_EACH_DEFINED_FUNCTION (node)
+    {
+      node->text_sorted_order = 0;
+      if (!clusterable_p (node))
+	continue;
+
+      int size = MAX (ipa_size_summaries->get (node)->size, 1);
+      gcov_type count = node->count.ipa ().to_gcov_type ();
+      function_cluster *c = new function_cluster (node, size, count);
+      clusters.safe_push (c);
+      cluster_of.put (node, c);
+    }
+
+  if (clusters.is_empty ())
+    return 0;
+
+  /* Every cluster holds a single function at this point.  */
+  auto_vec<function_cluster *> by_count;
+  by_count.safe_splice (clusters);
+  by_count.qsort (cluster_count_cmp);
+
+  for (function_cluster *single : by_count)
+    {
+      node = single->m_functions[0];
+
+      /* Find the most frequent caller of NODE.  */
+      cgraph_edge *best = NULL;
+      for (cgraph_edge *e = node->callers; e; e = e->next_caller)
+	if (e->count.ipa ().nonzero_p ()
+	    && (!best || e->count.ipa () > best->count.ipa ()))
+	  best = e;
+      if (!best)
+	continue;
+
+      cgraph_node *caller = best->caller->inlined_to
+			    ? best->caller->inlined_to : best->caller;
+      function_cluster **caller_slot = cluster_of.get (caller);
+      if (!caller_slot)
+	continue;
+
+      function_cluster *to = *caller_slot;
+      function_cluster *from = *cluster_of.get (node);
+      if (to == from)
+	continue;
+
+      if (to->m_size + from->m_size > param_reorder_functions_cluster_size)
+	continue;
+
+      sreal merged_density = sreal (to->m_count + from->m_count)
+			     / sreal (to->m_size + from->m_size);
+      if (merged_density * MAX_DENSITY_DEGRADATION < to->density ())
+	continue;
+
+      if (dump_file)
+	fprintf (dump_file, "Appending cluster of %s to cluster of %s\n",
+		 node->dump_name (), caller->dump_name ());
+
+      for (cgraph_node *moved : from->m_functions)
+	{
+	  to->m_functions.safe_push (moved);
+	  cluster_of.put (moved, to);
+	}
+      to->m_size += from->m_size;
+      to->m_count += from->m_count;
+      from->m_functions.truncate (0);
+    }
+
+  /* Drop the clusters that were merged into others.  */
+  unsigned ix = 0;
+  for (function_cluster *c : clusters)
+    if (c->m_functions.is_empty ())
+      delete c;
+    else
+      clusters[ix++] = c;
+  clusters.truncate (ix);
+  clusters.qsort (cluster_density_cmp);
+
+  unsigned int pos = 0;
+  for (function_cluster *c : clusters)
+    {
+      if (dump_file)
+	fprintf (dump_file, "Cluster of size %i, count %" PRId64
+		 ", density %f:\n", c->m_size, (int64_t) c->m_count,
+		 c->density ().to_double ());
+      for (cgraph_node *member : c->m_functions)
+	{
+	  member->text_sorted_order = ++pos;
+	  if (dump_file)
+	    fprintf (dump_file, "  %s: %u\n", member->dump_name (),
+		     member->text_sorted_order);
+	}
+      delete c;
+    }
+
+  return 0;
+}
+
+namespace {
+
+const pass_data pass_data_ipa_reorder =
+{
+  IPA_PASS, /* type */
+  "reorder", /* name */
+  OPTGROUP_NONE, /* optinfo_flags */
+  TV_IPA_REORDER, /* tv_id */
+  0, /* properties_required */
+  0, /* properties_provided */
+  0, /* properties_destroyed */
+  0, /* todo_flags_start */
+  0, /* todo_flags_finish */
+};
+
+class pass_ipa_reorder : public ipa_opt_pass_d
+{
+public:
+  pass_ipa_reorder (gcc::context *ctxt)
+    : ipa_opt_pass_d (pass_data_ipa_reorder, ctxt,
+		      NULL, /* generate_summary */
+		      NULL, /* write_summary */
+		      NULL, /* read_summary */
+		      NULL, /* write_optimization_summary */
+		      NULL, /* read_optimization_summary */
+		      NULL, /* stmt_fixup */
+		      0, /* function_transform_todo_flags_start */
+		      NULL, /* function_transform */
+		      NULL) /* variable_transform */
+  {}
+
+  /* opt_pass methods: */
+  bool gate (function *) final override
+    {
+      return (flag_reorder_functions
+	      && (flag_reorder_functions_algorithm
+		  == REORDER_FUNCTIONS_ALGORITHM_CALL_CHAIN_CLUSTERING));
+    }
+  unsigned int execute (function *) final override { return ipa_reorder (); }
+
+}; // class pass_ipa_reorder
+
+} // anon namespace
+
+ipa_opt_pass_d *
+make_pass_ipa_reorder (gcc::context *ctxt)
+{
+  return new pass_ipa_reorder (ctxt);
+}
@@ -31,6 +31,7 @@
 #include "rust-type-util.h"
 #include "rust-compile-implitem.h"
 #include "rust-attribute-values.h"
+#include "rust-session-manager.h"
 
 #include "fold-const.h"
 #include "stringpool.h"
@@ -426,6 +427,29 @@ HIRCompileBase::handle_must_use_attribute_on_fndecl (tree fndecl,
     = tree_cons (nodiscard, value, DECL_ATTRIBUTES (fndecl));
 }
 
+unsigned int
+HIRCompileBase::function_flags ()
+{
+  // with -frust-panic=abort, panics never unwind out of a function
+  const CompileOptions &options = Session::get_instance ().options;
+  if (options.get_panic_strategy () == CompileOptions::PanicStrategy::ABORT)
+    return Backend::function_does_not_throw;
+
+  return 0;
+}
+
+unsigned int
+HIRCompileBase::function_flags (const TyTy::FnType *fntype)
+{
+  unsigned int flags = function_flags ();
+
+  const TyTy::BaseType *ret = fntype->get_return_type ()->destructure ();
+  if (ret->get_kind () == TyTy::TypeKind::NEVER)
+    flags |= Backend::function_does_not_return;
+
+  return flags;
+}
+
 void
 HIRCompileBase::setup_abi_options (tree fndecl, ABI abi)
 {
@@ -672,6 +696,95 @@ get_abi (const AST::AttrVec &outer_attrs,
   return is_proc_macro ? ABI::CDECL : qualifiers.get_abi ();
 }
 
+// Returns true if TY may hold an UnsafeCell directly, rather than behind a
+// pointer, so that a shared reference to it can still observe writes.
+// Anything that cannot be inspected is assumed to hold one.
+
+static bool
+contains_unsafe_cell (const TyTy::BaseType *ty)
+{
+  ty = ty->destructure ();
+  switch (ty->get_kind ())
+    {
+      case TyTy::TypeKind::ADT: {
+	auto adt = static_cast<const TyTy::ADTType *> (ty);
+	auto mappings = Analysis::Mappings::get ();
+	DefId unsafe_cell;
+	if (mappings->lookup_lang_item (
+	      Analysis::RustLangItem::ItemType::UNSAFE_CELL, &unsafe_cell))
+	  {
+	    HIR::Item *item = mappings->lookup_defid (unsafe_cell);
+	    if (item != nullptr
+		&& item->get_mappings ().get_hirid () == adt->get_ref ())
+	      return true;
+	  }
+
+	for (auto &variant : adt->get_variants ())
+	  for (auto &field : variant->get_fields ())
+	    if (contains_unsafe_cell (field->get_field_type ()))
+	      return true;
+	return false;
+      }
+
+      case TyTy::TypeKind::TUPLE: {
+	auto tuple = static_cast<const TyTy::TupleType *> (ty);
+	for (auto &field : tuple->get_fields ())
+	  if (contains_unsafe_cell (field.get_tyty ()))
+	    return true;
+	return false;
+      }
+
+    case TyTy::TypeKind::ARRAY:
+      return contains_unsafe_cell (
+	static_cast<const TyTy::ArrayType *> (ty)->get_element_type ());
+
+    case TyTy::TypeKind::SLICE:
+      return contains_unsafe_cell (
+	static_cast<const TyTy::SliceType *> (ty)->get_element_type ());
+
+    case TyTy::TypeKind::BOOL:
+    case TyTy::TypeKind::CHAR:
+    case TyTy::TypeKind::INT:
+    case TyTy::TypeKind::UINT:
+    case TyTy::TypeKind::FLOAT:
+    case TyTy::TypeKind::USIZE:
+    case TyTy::TypeKind::ISIZE:
+    case TyTy::TypeKind::NEVER:
+    case TyTy::TypeKind::STR:
+    case TyTy::TypeKind::REF:
+    case TyTy::TypeKind::POINTER:
+    case TyTy::TypeKind::FNDEF:
+    case TyTy::TypeKind::FNPTR:
+      return false;
+
+    default:
+      return true;
+    }
+}
+
+// A `&mut T` is the only way to reach its pointee while it lives, and the
+// pointee of a `&T` is frozen unless it has interior mutability, so such
+// parameters are restrict-qualified for the benefit of alias analysis.
+// Being REFERENCE_TYPEs they are already known to be non-null and aligned
+// to their pointee, and a `&T` already points to a const-qualified T.
+
+static tree
+qualify_reference_param (const TyTy::BaseType *tyty, tree type)
+{
+  if (type == error_mark_node || !POINTER_TYPE_P (type))
+    return type;
+
+  tyty = tyty->destructure ();
+  if (tyty->get_kind () != TyTy::TypeKind::REF)
+    return type;
+
+  auto ref = static_cast<const TyTy::ReferenceType *> (tyty);
+  if (!ref->is_mutable () && contains_unsafe_cell (ref->get_base ()))
+    return type;
+
+  return Backend::restrict_type (type);
+}
+
 tree
 HIRCompileBase::compile_function (
   const std::string &fn_name, HIR::SelfParam &self_param,
@@ -688,7 +801,7 @@ HIRCompileBase::compile_function (
   bool is_main_fn = fn_name.compare ("main") == 0;
   std::string asm_name = fn_name;
 
-  unsigned int flags = 0;
+  unsigned int flags = function_flags (fntype);
   tree fndecl = Backend::function (compiled_fn_type, ir_symbol_name,
 				   "" /* asm_name */, flags, locus);
 
@@ -716,6 +829,7 @@ HIRCompileBase::compile_function (
       TyTy::BaseType *self_tyty_lookup = fntype->get_self_type ();
 
       tree self_type = TyTyResolveCompile::compile (ctx, self_tyty_lookup);
+      self_type = qualify_reference_param (self_tyty_lookup, self_type);
       Bvariable *compiled_self_param
 	= CompileSelfParam::compile (ctx, fndecl, self_param, self_type,
 				     self_param.get_locus ());
@@ -734,6 +848,8 @@ HIRCompileBase::compile_function (
       auto tyty_param = fntype->param_at (i++);
       auto param_tyty = tyty_param.second;
       auto compiled_param_type = TyTyResolveCompile::compile (ctx, param_tyty);
+      compiled_param_type
+	= qualify_reference_param (param_tyty, compiled_param_type);
 
       location_t param_locus = referenced_param.get_locus ();
       Bvariable *compiled_param_var
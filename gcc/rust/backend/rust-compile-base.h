@@ -31,6 +31,19 @@ public:
 
   static tree address_expression (tree expr, location_t locus);
 
+  /**
+   * Backend::function flags which depend on the compile options rather than
+   * on the function being compiled
+   */
+  static unsigned int function_flags ();
+
+  /**
+   * function_flags () plus the flags implied by the signature of FNTYPE:
+   * functions returning `!` are marked noreturn, so that calls to panic
+   * handlers and the like are predicted as cold without a profile
+   */
+  static unsigned int function_flags (const TyTy::FnType *fntype);
+
 protected:
   HIRCompileBase (Context *ctx) : ctx (ctx) {}
 
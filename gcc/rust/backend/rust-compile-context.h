@@ -152,6 +152,13 @@ public:
       mono_fns[dId] = {};
 
     mono_fns[dId].push_back ({ref, fn});
+
+    if (DECL_ASSEMBLER_NAME_SET_P (fn))
+      {
+	tree raw = DECL_ASSEMBLER_NAME_RAW (fn);
+	std::string name (IDENTIFIER_POINTER (raw), IDENTIFIER_LENGTH (raw));
+	mono_fns_by_asm_name.emplace (std::make_pair (dId, name), fn);
+      }
   }
 
   void insert_closure_decl (const TyTy::ClosureType *ref, tree fn)
@@ -192,6 +199,18 @@ public:
       {
 	rust_assert (dId != UNKNOWN_DEFID);
 
+	// instances are mostly looked up by their mangled name, which avoids
+	// comparing the type against every instance of the same definition
+	if (!asm_name.empty ())
+	  {
+	    auto named = mono_fns_by_asm_name.find ({dId, asm_name});
+	    if (named != mono_fns_by_asm_name.end ())
+	      {
+		*fn = named->second;
+		return true;
+	      }
+	  }
+
 	auto it = mono_fns.find (dId);
 	if (it == mono_fns.end ())
 	  return false;
@@ -405,6 +424,7 @@ private:
   std::vector<tree> loop_begin_labels;
   std::map<DefId, std::vector<std::pair<const TyTy::BaseType *, tree>>>
     mono_fns;
+  std::map<std::pair<DefId, std::string>, tree> mono_fns_by_asm_name;
   std::map<DefId, std::vector<std::pair<const TyTy::ClosureType *, tree>>>
     mono_closure_fns;
   std::map<HirId, tree> implicit_pattern_bindings;
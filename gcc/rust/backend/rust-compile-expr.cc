@@ -25,6 +25,7 @@
 #include "rust-constexpr.h"
 #include "rust-compile-type.h"
 #include "rust-gcc.h"
+#include "rust-builtins.h"
 
 #include "fold-const.h"
 #include "realmpfr.h"
@@ -977,6 +978,111 @@ check_match_scrutinee (HIR::MatchExpr &expr, Context *ctx)
   return scrutinee_kind;
 }
 
+// Helper for match_arms_cover_scrutinee.
+// Return true if the check compiled for PATTERN on an enum only tests the
+// discriminant, recording the variant it tests in COVERED.
+static bool
+covers_whole_variant (HIR::Pattern &pattern, TyTy::ADTType *adt,
+		      std::set<int> &covered, Context *ctx)
+{
+  HirId path_id;
+  switch (pattern.get_pattern_type ())
+    {
+    case HIR::Pattern::PatternType::PATH:
+      path_id = pattern.get_mappings ().get_hirid ();
+      break;
+
+      case HIR::Pattern::PatternType::TUPLE_STRUCT: {
+	auto &tuple_struct = static_cast<HIR::TupleStructPattern &> (pattern);
+	auto &items = tuple_struct.get_items ();
+	if (items->get_item_type () != HIR::TupleStructItems::MULTIPLE)
+	  return false;
+
+	auto &items_no_range
+	  = static_cast<HIR::TupleStructItemsNoRange &> (*items.get ());
+	for (auto &item : items_no_range.get_patterns ())
+	  {
+	    auto item_type = item->get_pattern_type ();
+	    if (item_type == HIR::Pattern::PatternType::IDENTIFIER)
+	      {
+		auto &ident = static_cast<HIR::IdentifierPattern &> (*item);
+		if (ident.has_pattern_to_bind ())
+		  return false;
+	      }
+	    else if (item_type != HIR::Pattern::PatternType::WILDCARD)
+	      return false;
+	  }
+	path_id = tuple_struct.get_path ().get_mappings ().get_hirid ();
+      }
+      break;
+
+    default:
+      return false;
+    }
+
+  HirId variant_id;
+  if (!ctx->get_tyctx ()->lookup_variant_definition (path_id, &variant_id))
+    return false;
+
+  TyTy::VariantDef *variant = nullptr;
+  int variant_index = 0;
+  if (!adt->lookup_variant_by_id (variant_id, &variant, &variant_index))
+    return false;
+
+  covered.insert (variant_index);
+  return true;
+}
+
+// Helper for CompileExpr::visit (HIR::MatchExpr).
+// Return true if the unguarded arms of EXPR are known to test every value of
+// a scrutinee of type SCRUTINEE: every variant of an enum, or both values of
+// a bool.  Control then never falls out of the chain of arm checks, and
+// saying so lets the value range of the discriminant be derived from the
+// checks rather than from its type.
+static bool
+match_arms_cover_scrutinee (HIR::MatchExpr &expr, TyTy::BaseType *scrutinee,
+			    Context *ctx)
+{
+  TyTy::ADTType *adt = nullptr;
+  if (scrutinee->get_kind () == TyTy::TypeKind::ADT)
+    adt = static_cast<TyTy::ADTType *> (scrutinee);
+  else if (scrutinee->get_kind () != TyTy::TypeKind::BOOL)
+    return false;
+
+  std::set<int> covered_variants;
+  bool covered_bools[2] = {false, false};
+  for (auto &kase : expr.get_match_cases ())
+    {
+      HIR::MatchArm &kase_arm = kase.get_arm ();
+      if (kase_arm.has_match_arm_guard ())
+	continue;
+
+      for (auto &kase_pattern : kase_arm.get_patterns ())
+	{
+	  if (adt != nullptr)
+	    {
+	      covers_whole_variant (*kase_pattern, adt, covered_variants, ctx);
+	      continue;
+	    }
+
+	  if (kase_pattern->get_pattern_type ()
+	      != HIR::Pattern::PatternType::LITERAL)
+	    continue;
+
+	  auto &lit = static_cast<HIR::LiteralPattern &> (*kase_pattern);
+	  if (lit.get_literal ().get_lit_type () != HIR::Literal::LitType::BOOL)
+	    continue;
+
+	  covered_bools[lit.get_literal ().as_string () == "true"] = true;
+	}
+    }
+
+  if (adt != nullptr)
+    return covered_variants.size () == adt->number_of_variants ();
+
+  return covered_bools[0] && covered_bools[1];
+}
+
 void
 CompileExpr::visit (HIR::MatchExpr &expr)
 {
@@ -1090,6 +1196,23 @@ CompileExpr::visit (HIR::MatchExpr &expr)
 	}
     }
 
+  TyTy::BaseType *scrutinee_tyty = nullptr;
+  bool ok = ctx->get_tyctx ()->lookup_type (
+    expr.get_scrutinee_expr ()->get_mappings ().get_hirid (), &scrutinee_tyty);
+  rust_assert (ok);
+
+  if (match_arms_cover_scrutinee (expr, scrutinee_tyty, ctx))
+    {
+      tree unreachable_fn = error_mark_node;
+      BuiltinsContext::get ().lookup_simple_builtin ("unreachable",
+						     &unreachable_fn);
+      rust_assert (unreachable_fn != error_mark_node);
+
+      tree unreachable_call
+	= build_call_expr_loc (expr.get_locus (), unreachable_fn, 0);
+      ctx->add_statement (unreachable_call);
+    }
+
   // setup the switch expression
   ctx->add_statement (end_label_decl_statement);
 
@@ -1406,10 +1529,12 @@ CompileExpr::get_fn_addr_from_dyn (const TyTy::DynamicObjectType *dyn,
     = build4_loc (expr_locus, ARRAY_REF, TREE_TYPE (TREE_TYPE (vtable_ptr)),
 		  vtable_ptr, idx, NULL_TREE, NULL_TREE);
 
-  tree vcall = build3_loc (expr_locus, OBJ_TYPE_REF, expected_fntype,
-			   vtable_array_access, receiver_ref, idx);
-
-  return vcall;
+  // This is deliberately a plain indirect call rather than an OBJ_TYPE_REF:
+  // the vtable lives inside the trait object and has no BINFO, so the
+  // polymorphic call machinery cannot use it, while a plain load from the
+  // trait object lets ipa-prop track known vtables passed by callers and
+  // lets indirect call profiling speculate on the most common target.
+  return fold_convert_loc (expr_locus, expected_fntype, vtable_array_access);
 }
 
 tree
@@ -2229,7 +2354,7 @@ CompileExpr::generate_closure_function (HIR::ClosureExpr &expr,
   std::string ir_symbol_name = path.get ();
   std::string asm_name = ctx->mangle_item (&closure_tyty, path);
 
-  unsigned int flags = 0;
+  unsigned int flags = function_flags ();
   tree fndecl = Backend::function (compiled_fn_type, ir_symbol_name, asm_name,
 				   flags, expr.get_locus ());
 
@@ -141,7 +141,8 @@ public:
 	asm_name = ctx->mangle_item (fntype, *canonical_path);
       }
 
-    const unsigned int flags = Backend::function_is_declaration;
+    const unsigned int flags
+      = Backend::function_is_declaration | function_flags (fntype);
     tree fndecl = Backend::function (compiled_fn_type, ir_symbol_name, asm_name,
 				     flags, function.get_locus ());
     TREE_PUBLIC (fndecl) = 1;
@@ -331,7 +331,7 @@ compile_intrinsic_function (Context *ctx, TyTy::FnType *fntype)
     = canonical_path.get () + fntype->subst_as_string ();
   std::string asm_name = ctx->mangle_item (fntype, canonical_path);
 
-  unsigned int flags = 0;
+  unsigned int flags = HIRCompileBase::function_flags ();
   tree fndecl = Backend::function (compiled_fn_type, ir_symbol_name, asm_name,
 				   flags, fntype->get_ident ().locus);
 
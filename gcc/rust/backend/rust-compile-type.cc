@@ -718,8 +718,12 @@ TyTyResolveCompile::create_dyn_obj_record (const TyTy::DynamicObjectType &type)
 				 type.get_ty_ref ()));
   fields.push_back (std::move (f));
 
+  // the vtable slots are typed as function pointers so that loading one and
+  // calling through it needs no conversion the middle-end has to preserve
+  tree vtable_entry_ty
+    = build_pointer_type (build_function_type (void_type_node, void_list_node));
   tree vtable_size = build_int_cst (size_type_node, items.size ());
-  tree vtable_type = Backend::array_type (uintptr_ty, vtable_size);
+  tree vtable_type = Backend::array_type (vtable_entry_ty, vtable_size);
   Backend::typed_identifier vtf ("vtable", vtable_type,
 				 ctx->get_mappings ()->lookup_location (
 				   type.get_ty_ref ()));
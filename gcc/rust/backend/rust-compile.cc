@@ -208,6 +208,7 @@ HIRCompileBase::coerce_to_dyn_object (tree compiled_ref,
   if (!actual->is_unit ())
     address_of_compiled_ref = address_expression (compiled_ref, locus);
 
+  tree vtable_entry_type = TREE_TYPE (TREE_TYPE (vtable_field));
   std::vector<tree> vtable_ctor_elems;
   std::vector<unsigned long> vtable_ctor_idx;
   unsigned long i = 0;
@@ -219,7 +220,8 @@ HIRCompileBase::coerce_to_dyn_object (tree compiled_ref,
       auto address = compute_address_for_trait_item (item, predicate,
 						     probed_bounds_for_receiver,
 						     actual, actual, locus);
-      vtable_ctor_elems.push_back (address);
+      vtable_ctor_elems.push_back (
+	fold_convert_loc (locus, vtable_entry_type, address));
       vtable_ctor_idx.push_back (i++);
     }
 
@@ -23,10 +23,6 @@
 #include "rust-name-resolver.h"
 #include "rust-visibility-resolver.h"
 #include "rust-pub-restricted-visitor.h"
-#include "rust-privacy-reporter.h"
-
-extern bool
-saw_errors (void);
 
 namespace Rust {
 namespace Privacy {
@@ -39,23 +35,18 @@ Resolver::resolve (HIR::Crate &crate)
   auto resolver = Rust::Resolver::Resolver::get ();
   auto ty_ctx = ::Rust::Resolver::TypeCheckContext::get ();
 
-  VisibilityResolver (*mappings, *resolver).go (crate);
-  PubRestrictedVisitor (*mappings).go (crate);
-  PrivacyReporter (*mappings, *resolver, *ty_ctx).go (crate);
-
-  auto visitor = ReachabilityVisitor (ctx, *ty_ctx);
-
-  for (auto &item : crate.get_items ())
-    {
-      if (item->get_hir_kind () == HIR::Node::VIS_ITEM)
-	{
-	  auto vis_item = static_cast<HIR::VisItem *> (item.get ());
-	  vis_item->accept_vis (visitor);
-	}
-    }
-
-  if (saw_errors ())
-    return;
+  // The item-level passes share a single walk over the crate. The
+  // pub(restricted) check of an item only needs the visibility of that same
+  // item, which the visibility resolver computes just before it.
+  VisibilityResolver visibility_resolver (*mappings, *resolver);
+  PubRestrictedVisitor pub_restricted (*mappings);
+  ReachabilityVisitor reachability (ctx, *ty_ctx);
+
+  HIR::FusedItemWalker walker;
+  walker.add_pass (visibility_resolver);
+  walker.add_pass (pub_restricted);
+  walker.add_pass (reachability);
+  walker.go (crate);
 }
 } // namespace Privacy
 } // namespace Rust
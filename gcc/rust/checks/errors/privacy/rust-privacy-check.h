@@ -31,10 +31,12 @@ class Resolver
 {
 public:
   /**
-   * Perform the full privacy resolving pass on a crate.
+   * Resolve the visibility and reachability of all items in a crate, and
+   * check their pub(restricted) visibilities.
    *
-   * This resolver first computes the reachability of all items in a crate,
-   * before checking for privacy violations.
+   * Privacy violations in expressions are reported afterwards by the
+   * `PrivacyReporter`, which shares its walk over the crate with the other
+   * checking passes.
    */
   static void resolve (HIR::Crate &crate);
 };
@@ -81,12 +81,19 @@ proc_macro_privacy_check (std::unique_ptr<HIR::Item> &item)
 void
 PrivacyReporter::go (HIR::Crate &crate)
 {
+  HIR::FusedCheckWalker walker;
+  walker.add_pass (*this);
+  walker.go (crate);
+}
+
+void
+PrivacyReporter::enter_crate (HIR::Crate &crate)
+{
+  if (!Session::get_instance ().options.is_proc_macro ())
+    return;
+
   for (auto &item : crate.get_items ())
-    {
-      if (Session::get_instance ().options.is_proc_macro ())
-	proc_macro_privacy_check (item);
-      item->accept_vis (*this);
-    }
+    proc_macro_privacy_check (item);
 }
 
 static bool
@@ -281,19 +288,6 @@ PrivacyReporter::visit (HIR::PathInExpression &path)
 			       path.get_locus ());
 }
 
-void
-PrivacyReporter::visit (HIR::TypePathSegmentFunction &)
-{
-  // FIXME: Do we need to do anything for this?
-}
-
-void
-PrivacyReporter::visit (HIR::TypePath &path)
-{
-  check_for_privacy_violation (path.get_mappings ().get_nodeid (),
-			       path.get_locus ());
-}
-
 void
 PrivacyReporter::visit (HIR::QualifiedPathInExpression &path)
 {
@@ -301,354 +295,19 @@ PrivacyReporter::visit (HIR::QualifiedPathInExpression &path)
 			       path.get_locus ());
 }
 
-void
-PrivacyReporter::visit (HIR::QualifiedPathInType &path)
-{
-  check_for_privacy_violation (path.get_mappings ().get_nodeid (),
-			       path.get_locus ());
-}
-
-void
-PrivacyReporter::visit (HIR::LiteralExpr &)
-{
-  // Literals cannot contain any sort of privacy violation
-}
-
-void
-PrivacyReporter::visit (HIR::BorrowExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::DereferenceExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ErrorPropagationExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::NegationExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ArithmeticOrLogicalExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ComparisonExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::LazyBooleanExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::TypeCastExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::AssignmentExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::CompoundAssignmentExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::GroupedExpr &expr)
-{
-  expr.get_expr_in_parens ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ArrayExpr &expr)
-{
-  HIR::ArrayElems &elements = *expr.get_internal_elements ();
-  switch (elements.get_array_expr_type ())
-    {
-      case HIR::ArrayElems::ArrayExprType::VALUES: {
-	HIR::ArrayElemsValues &elems
-	  = static_cast<HIR::ArrayElemsValues &> (elements);
-	for (auto &value : elems.get_values ())
-	  value->accept_vis (*this);
-      }
-      return;
-
-    case HIR::ArrayElems::ArrayExprType::COPIED:
-      HIR::ArrayElemsCopied &elems
-	= static_cast<HIR::ArrayElemsCopied &> (elements);
-      elems.get_elem_to_copy ()->accept_vis (*this);
-    }
-}
-
-void
-PrivacyReporter::visit (HIR::ArrayIndexExpr &expr)
-{
-  expr.get_array_expr ()->accept_vis (*this);
-  expr.get_index_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::TupleExpr &expr)
-{
-  for (auto &value : expr.get_tuple_elems ())
-    value->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::TupleIndexExpr &expr)
-{
-  expr.get_tuple_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::StructExprStruct &)
-{
-  // FIXME: We need to check the visibility of the type it refers to here
-}
-
-void
-PrivacyReporter::visit (HIR::StructExprFieldIdentifier &)
-{}
-
-void
-PrivacyReporter::visit (HIR::StructExprFieldIdentifierValue &field)
-{
-  field.get_value ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::StructExprFieldIndexValue &field)
-{
-  field.get_value ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::StructExprStructFields &expr)
-{
-  for (auto &field : expr.get_fields ())
-    field->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::CallExpr &expr)
-{
-  expr.get_fnexpr ()->accept_vis (*this);
-
-  for (auto &param : expr.get_arguments ())
-    param->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::MethodCallExpr &expr)
-{
-  expr.get_receiver ()->accept_vis (*this);
-
-  for (auto &param : expr.get_arguments ())
-    param->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::FieldAccessExpr &expr)
-{
-  expr.get_receiver_expr ()->accept_vis (*this);
-
-  // FIXME: We should also check if the field is public?
-}
-
-void
-PrivacyReporter::visit (HIR::ClosureExpr &)
-{
-  // Not handled yet
-}
-
-void
-PrivacyReporter::visit (HIR::BlockExpr &expr)
-{
-  for (auto &stmt : expr.get_statements ())
-    stmt->accept_vis (*this);
-
-  auto &last_expr = expr.get_final_expr ();
-  if (last_expr)
-    last_expr->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ContinueExpr &)
-{}
-
-void
-PrivacyReporter::visit (HIR::BreakExpr &expr)
-{
-  auto &break_expr = expr.get_expr ();
-  if (break_expr)
-    break_expr->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::RangeFromToExpr &expr)
-{
-  expr.get_from_expr ()->accept_vis (*this);
-  expr.get_to_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::RangeFromExpr &expr)
-{
-  expr.get_from_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::RangeToExpr &expr)
-{
-  expr.get_to_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::RangeFullExpr &)
-{}
-
-void
-PrivacyReporter::visit (HIR::RangeFromToInclExpr &expr)
-{
-  expr.get_from_expr ()->accept_vis (*this);
-  expr.get_to_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::RangeToInclExpr &)
-{
-  // Not handled yet
-}
-
-void
-PrivacyReporter::visit (HIR::ReturnExpr &expr)
-{
-  if (expr.get_expr ())
-    expr.get_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::UnsafeBlockExpr &expr)
-{
-  expr.get_block_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::LoopExpr &expr)
-{
-  expr.get_loop_block ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::WhileLoopExpr &expr)
-{
-  expr.get_predicate_expr ()->accept_vis (*this);
-  expr.get_loop_block ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::WhileLetLoopExpr &expr)
-{
-  expr.get_cond ()->accept_vis (*this);
-  expr.get_loop_block ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::IfExpr &expr)
-{
-  expr.get_if_condition ()->accept_vis (*this);
-  expr.get_if_block ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::IfExprConseqElse &expr)
-{
-  expr.get_if_condition ()->accept_vis (*this);
-  expr.get_if_block ()->accept_vis (*this);
-  expr.get_else_block ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::IfLetExpr &)
-{
-  // TODO: We need to visit the if_let_expr
-  // TODO: We need to visit the block as well
-}
-
-void
-PrivacyReporter::visit (HIR::IfLetExprConseqElse &)
-{
-  // TODO: We need to visit the if_let_expr
-  // TODO: We need to visit the if_block as well
-  // TODO: We need to visit the else_block as well
-}
-
-void
-PrivacyReporter::visit (HIR::MatchExpr &expr)
-{
-  expr.get_scrutinee_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::AwaitExpr &)
-{
-  // Not handled yet
-}
-
-void
-PrivacyReporter::visit (HIR::AsyncBlockExpr &)
-{
-  // Not handled yet
-}
-
 void
 PrivacyReporter::visit (HIR::Module &module)
 {
   // FIXME: We also need to think about module privacy
-
-  auto old_module = current_module;
+  parent_modules.push_back (current_module);
   current_module = module.get_mappings ().get_nodeid ();
-
-  for (auto &item : module.get_items ())
-    item->accept_vis (*this);
-
-  current_module = old_module;
 }
 
 void
-PrivacyReporter::visit (HIR::ExternCrate &)
-{}
-
-void
-PrivacyReporter::visit (HIR::UseDeclaration &)
+PrivacyReporter::leave (HIR::Module &)
 {
-  // FIXME: Is there anything we need to do here?
+  current_module = parent_modules.back ();
+  parent_modules.pop_back ();
 }
 
 void
@@ -656,115 +315,13 @@ PrivacyReporter::visit (HIR::Function &function)
 {
   for (auto &param : function.get_function_params ())
     check_type_privacy (param.get_type ().get ());
-
-  function.get_definition ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::TypeAlias &)
-{
-  // TODO: Check the type here
-}
-
-void
-PrivacyReporter::visit (HIR::StructStruct &)
-{
-  // TODO: Check the type of all fields
-}
-
-void
-PrivacyReporter::visit (HIR::TupleStruct &)
-{
-  // TODO: Check the type of all fields
-}
-
-void
-PrivacyReporter::visit (HIR::EnumItem &)
-{
-  // TODO: Check the type of all variants
-}
-
-void
-PrivacyReporter::visit (HIR::EnumItemTuple &)
-{
-  // TODO: Check the type
-}
-
-void
-PrivacyReporter::visit (HIR::EnumItemStruct &)
-{
-  // TODO: Check the type
-}
-
-void
-PrivacyReporter::visit (HIR::EnumItemDiscriminant &)
-{}
-
-void
-PrivacyReporter::visit (HIR::Enum &)
-{}
-
-void
-PrivacyReporter::visit (HIR::Union &)
-{
-  // TODO: Check the type
-}
-
-void
-PrivacyReporter::visit (HIR::ConstantItem &const_item)
-{
-  // TODO: We need to visit the type
-  const_item.get_expr ()->accept_vis (*this);
 }
 
-void
-PrivacyReporter::visit (HIR::StaticItem &static_item)
-{
-  // TODO: We need to visit the type
-  static_item.get_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::Trait &)
-{
-  // FIXME: We need to be an ItemVisitor as well
-  // for (auto &item : trait.get_trait_items ())
-  //   item->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ImplBlock &impl)
-{
-  for (auto &item : impl.get_impl_items ())
-    item->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ExternBlock &)
-{
-  // FIXME: We need to be an ItemVisitor as well
-  // for (auto &block: block.get_extern_items ())
-  //   item->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::EmptyStmt &)
-{}
-
 void
 PrivacyReporter::visit (HIR::LetStmt &stmt)
 {
   if (stmt.get_type ())
     check_type_privacy (stmt.get_type ().get ());
-
-  if (stmt.get_init_expr ())
-    stmt.get_init_expr ()->accept_vis (*this);
-}
-
-void
-PrivacyReporter::visit (HIR::ExprStmt &stmt)
-{
-  stmt.get_expr ()->accept_vis (*this);
 }
 
 } // namespace Privacy
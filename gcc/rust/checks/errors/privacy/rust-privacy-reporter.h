@@ -20,7 +20,7 @@
 #define RUST_PRIVACY_REPORTER_H
 
 #include "rust-hir-map.h"
-#include "rust-hir-visitor.h"
+#include "rust-fused-check-walker.h"
 #include "rust-mapping-common.h"
 #include "rust-name-resolver.h"
 
@@ -32,8 +32,7 @@ namespace Privacy {
  * violations. It should be started after using the `VisibilityResolver` visitor
  * which resolves the visibilities of all items of a crate.
  */
-class PrivacyReporter : public HIR::HIRExpressionVisitor,
-			public HIR::HIRStmtVisitor
+class PrivacyReporter : public HIR::FusableCheckPass
 {
 public:
   PrivacyReporter (Analysis::Mappings &mappings,
@@ -77,80 +76,16 @@ types
    */
   void check_type_privacy (const HIR::Type *type);
 
-  virtual void visit (HIR::StructExprFieldIdentifier &field);
-  virtual void visit (HIR::StructExprFieldIdentifierValue &field);
-  virtual void visit (HIR::StructExprFieldIndexValue &field);
-
-  virtual void visit (HIR::QualifiedPathInExpression &expr);
-  virtual void visit (HIR::PathInExpression &expr);
-  virtual void visit (HIR::ClosureExpr &expr);
-  virtual void visit (HIR::StructExprStructFields &);
-  virtual void visit (HIR::StructExprStruct &);
-  virtual void visit (HIR::LiteralExpr &expr);
-  virtual void visit (HIR::BorrowExpr &expr);
-  virtual void visit (HIR::DereferenceExpr &expr);
-  virtual void visit (HIR::ErrorPropagationExpr &expr);
-  virtual void visit (HIR::NegationExpr &expr);
-  virtual void visit (HIR::ArithmeticOrLogicalExpr &expr);
-  virtual void visit (HIR::ComparisonExpr &expr);
-  virtual void visit (HIR::LazyBooleanExpr &expr);
-  virtual void visit (HIR::TypeCastExpr &expr);
-  virtual void visit (HIR::AssignmentExpr &expr);
-  virtual void visit (HIR::CompoundAssignmentExpr &expr);
-  virtual void visit (HIR::GroupedExpr &expr);
-  virtual void visit (HIR::ArrayExpr &expr);
-  virtual void visit (HIR::ArrayIndexExpr &expr);
-  virtual void visit (HIR::TupleExpr &expr);
-  virtual void visit (HIR::TupleIndexExpr &expr);
-  virtual void visit (HIR::CallExpr &expr);
-  virtual void visit (HIR::MethodCallExpr &expr);
-  virtual void visit (HIR::FieldAccessExpr &expr);
-  virtual void visit (HIR::BlockExpr &expr);
-  virtual void visit (HIR::ContinueExpr &expr);
-  virtual void visit (HIR::BreakExpr &expr);
-  virtual void visit (HIR::RangeFromToExpr &expr);
-  virtual void visit (HIR::RangeFromExpr &expr);
-  virtual void visit (HIR::RangeToExpr &expr);
-  virtual void visit (HIR::RangeFullExpr &expr);
-  virtual void visit (HIR::RangeFromToInclExpr &expr);
-  virtual void visit (HIR::RangeToInclExpr &expr);
-  virtual void visit (HIR::ReturnExpr &expr);
-  virtual void visit (HIR::UnsafeBlockExpr &expr);
-  virtual void visit (HIR::LoopExpr &expr);
-  virtual void visit (HIR::WhileLoopExpr &expr);
-  virtual void visit (HIR::WhileLetLoopExpr &expr);
-  virtual void visit (HIR::IfExpr &expr);
-  virtual void visit (HIR::IfExprConseqElse &expr);
-  virtual void visit (HIR::IfLetExpr &expr);
-  virtual void visit (HIR::IfLetExprConseqElse &expr);
-  virtual void visit (HIR::MatchExpr &expr);
-  virtual void visit (HIR::AwaitExpr &expr);
-  virtual void visit (HIR::AsyncBlockExpr &expr);
-
-  virtual void visit (HIR::EnumItemTuple &);
-  virtual void visit (HIR::EnumItemStruct &);
-  virtual void visit (HIR::EnumItem &item);
-  virtual void visit (HIR::TupleStruct &tuple_struct);
-  virtual void visit (HIR::EnumItemDiscriminant &);
-  virtual void visit (HIR::TypePathSegmentFunction &segment);
-  virtual void visit (HIR::TypePath &path);
-  virtual void visit (HIR::QualifiedPathInType &path);
-  virtual void visit (HIR::Module &module);
-  virtual void visit (HIR::ExternCrate &crate);
-  virtual void visit (HIR::UseDeclaration &use_decl);
-  virtual void visit (HIR::Function &function);
-  virtual void visit (HIR::TypeAlias &type_alias);
-  virtual void visit (HIR::StructStruct &struct_item);
-  virtual void visit (HIR::Enum &enum_item);
-  virtual void visit (HIR::Union &union_item);
-  virtual void visit (HIR::ConstantItem &const_item);
-  virtual void visit (HIR::StaticItem &static_item);
-  virtual void visit (HIR::Trait &trait);
-  virtual void visit (HIR::ImplBlock &impl);
-  virtual void visit (HIR::ExternBlock &block);
-  virtual void visit (HIR::EmptyStmt &stmt);
-  virtual void visit (HIR::LetStmt &stmt);
-  virtual void visit (HIR::ExprStmt &stmt);
+  using HIR::FusableCheckPass::leave;
+  using HIR::FusableCheckPass::visit;
+
+  virtual void enter_crate (HIR::Crate &crate) override;
+  virtual void visit (HIR::QualifiedPathInExpression &expr) override;
+  virtual void visit (HIR::PathInExpression &expr) override;
+  virtual void visit (HIR::Module &module) override;
+  virtual void leave (HIR::Module &module) override;
+  virtual void visit (HIR::Function &function) override;
+  virtual void visit (HIR::LetStmt &stmt) override;
 
   Analysis::Mappings &mappings;
   Rust::Resolver::Resolver &resolver;
@@ -158,6 +93,7 @@ types
 
   // `None` means we're in the root module - the crate
   tl::optional<NodeId> current_module;
+  std::vector<tl::optional<NodeId>> parent_modules;
 };
 
 } // namespace Privacy
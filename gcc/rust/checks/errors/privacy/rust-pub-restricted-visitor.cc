@@ -50,21 +50,20 @@ PubRestrictedVisitor::PubRestrictedVisitor (Analysis::Mappings &mappings)
 
 void
 PubRestrictedVisitor::go (HIR::Crate &crate)
+{
+  HIR::FusedItemWalker walker;
+  walker.add_pass (*this);
+  walker.go (crate);
+}
+
+void
+PubRestrictedVisitor::enter_crate (HIR::Crate &crate)
 {
   // The `crate` module will always be present
   module_stack.emplace_back (crate.get_mappings ().get_defid ());
 
   // FIXME: When do we insert `super`? `self`?
   // We need wrapper function for these
-
-  for (auto &item : crate.get_items ())
-    {
-      if (item->get_hir_kind () == HIR::Node::VIS_ITEM)
-	{
-	  auto vis_item = static_cast<HIR::VisItem *> (item.get ());
-	  vis_item->accept_vis (*this);
-	}
-    }
 }
 
 void
@@ -74,16 +73,11 @@ PubRestrictedVisitor::visit (HIR::Module &mod)
   module_stack.push_back (mod.get_mappings ().get_defid ());
 
   is_restriction_valid (mod.get_mappings ().get_nodeid (), mod.get_locus ());
+}
 
-  for (auto &item : mod.get_items ())
-    {
-      if (item->get_hir_kind () == HIR::Node::VIS_ITEM)
-	{
-	  auto vis_item = static_cast<HIR::VisItem *> (item.get ());
-	  vis_item->accept_vis (*this);
-	}
-    }
-
+void
+PubRestrictedVisitor::exit_module (HIR::Module &)
+{
   module_stack.pop_back ();
 }
 
@@ -19,7 +19,7 @@
 #ifndef RUST_PUB_RESTRICTED_VISITOR_H
 #define RUST_PUB_RESTRICTED_VISITOR_H
 
-#include "rust-hir-visitor.h"
+#include "rust-fused-item-walker.h"
 #include "rust-hir.h"
 #include "rust-hir-expr.h"
 #include "rust-hir-stmt.h"
@@ -67,7 +67,7 @@ namespace Privacy {
  * edition, as the paths there must be absolute and not relative (`c::d` would
  * become `crate::a::b::c::d` etc). Nonetheless, the logic stays the same.
  */
-class PubRestrictedVisitor : public HIR::HIRVisItemVisitor
+class PubRestrictedVisitor : public HIR::FusableItemPass
 {
 public:
   PubRestrictedVisitor (Analysis::Mappings &mappings);
@@ -89,6 +89,9 @@ public:
    */
   bool is_restriction_valid (NodeId item_id, const location_t locus);
 
+  virtual void enter_crate (HIR::Crate &crate);
+  virtual void exit_module (HIR::Module &mod);
+
   virtual void visit (HIR::Module &mod);
   virtual void visit (HIR::ExternCrate &crate);
   virtual void visit (HIR::UseDeclaration &use_decl);
@@ -22,15 +22,6 @@
 namespace Rust {
 namespace Privacy {
 
-static HIR::VisItem *
-maybe_get_vis_item (std::unique_ptr<HIR::Item> &item)
-{
-  if (item->get_hir_kind () != HIR::Node::VIS_ITEM)
-    return nullptr;
-
-  return static_cast<HIR::VisItem *> (item.get ());
-}
-
 ReachLevel
 ReachabilityVisitor::get_reachability_level (
   const HIR::Visibility &item_visibility)
@@ -66,22 +57,19 @@ ReachabilityVisitor::visit_generic_predicates (
     }
 }
 
+void
+ReachabilityVisitor::go (HIR::Crate &crate)
+{
+  HIR::FusedItemWalker walker;
+  walker.add_pass (*this);
+  walker.go (crate);
+}
+
 void
 ReachabilityVisitor::visit (HIR::Module &mod)
 {
   auto reach = get_reachability_level (mod.get_visibility ());
   reach = ctx.update_reachability (mod.get_mappings (), reach);
-
-  for (auto &item : mod.get_items ())
-    {
-      // FIXME: Is that what we want to do? Yes? Only visit the items with
-      // visibility?
-      //
-      // Imagine if we had `maybe_get_vis_item(item)?->accept_vis(*this)` ;)
-      auto vis_item = maybe_get_vis_item (item);
-      if (vis_item)
-	vis_item->accept_vis (*this);
-    }
 }
 
 void
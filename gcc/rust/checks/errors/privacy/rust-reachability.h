@@ -20,7 +20,7 @@
 #define RUST_REACHABILITY_H
 
 #include "rust-privacy-ctx.h"
-#include "rust-hir-visitor.h"
+#include "rust-fused-item-walker.h"
 #include "rust-hir.h"
 #include "rust-hir-expr.h"
 #include "rust-hir-stmt.h"
@@ -38,7 +38,7 @@ namespace Privacy {
  * The ReachabilityVisitor tries to reach all items possible in the crate,
  * according to their privacy level.
  */
-class ReachabilityVisitor : public HIR::HIRVisItemVisitor
+class ReachabilityVisitor : public HIR::FusableItemPass
 {
 public:
   ReachabilityVisitor (PrivacyContext &ctx,
@@ -46,7 +46,7 @@ public:
     : current_level (ReachLevel::Reachable), ctx (ctx), ty_ctx (ty_ctx)
   {}
 
-  // FIXME: Add `go` method which takes an `HIR::Crate &` as argument
+  void go (HIR::Crate &crate);
 
   /**
    * Visit all the predicates of all the generic types of a given item, marking
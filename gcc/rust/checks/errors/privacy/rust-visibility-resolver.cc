@@ -31,20 +31,19 @@ VisibilityResolver::VisibilityResolver (Analysis::Mappings &mappings,
 
 void
 VisibilityResolver::go (HIR::Crate &crate)
+{
+  HIR::FusedItemWalker walker;
+  walker.add_pass (*this);
+  walker.go (crate);
+}
+
+void
+VisibilityResolver::enter_crate (HIR::Crate &crate)
 {
   mappings.insert_visibility (crate.get_mappings ().get_nodeid (),
 			      ModuleVisibility::create_public ());
 
   current_module = crate.get_mappings ().get_defid ();
-
-  for (auto &item : crate.get_items ())
-    {
-      if (item->get_hir_kind () == HIR::Node::VIS_ITEM)
-	{
-	  auto vis_item = static_cast<HIR::VisItem *> (item.get ());
-	  vis_item->accept_vis (*this);
-	}
-    }
 }
 
 bool
@@ -135,19 +134,15 @@ VisibilityResolver::resolve_and_update (const HIR::VisItem *item)
 void
 VisibilityResolver::visit (HIR::Module &mod)
 {
-  auto old_module = current_module;
+  module_stack.push_back (current_module);
   current_module = mod.get_mappings ().get_defid ();
+}
 
-  for (auto &item : mod.get_items ())
-    {
-      if (item->get_hir_kind () == HIR::Node::VIS_ITEM)
-	{
-	  auto vis_item = static_cast<HIR::VisItem *> (item.get ());
-	  vis_item->accept_vis (*this);
-	}
-    }
-
-  current_module = old_module;
+void
+VisibilityResolver::exit_module (HIR::Module &)
+{
+  current_module = module_stack.back ();
+  module_stack.pop_back ();
 }
 
 void
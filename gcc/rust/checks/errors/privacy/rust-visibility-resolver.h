@@ -25,12 +25,12 @@
 #include "rust-hir-item.h"
 #include "rust-hir-map.h"
 #include "rust-name-resolver.h"
-#include "rust-hir-visitor.h"
+#include "rust-fused-item-walker.h"
 
 namespace Rust {
 namespace Privacy {
 
-class VisibilityResolver : public HIR::HIRVisItemVisitor
+class VisibilityResolver : public HIR::FusableItemPass
 {
 public:
   VisibilityResolver (Analysis::Mappings &mappings,
@@ -76,6 +76,9 @@ public:
    */
   DefId peek_module ();
 
+  virtual void enter_crate (HIR::Crate &crate);
+  virtual void exit_module (HIR::Module &mod);
+
   virtual void visit (HIR::Module &mod);
   virtual void visit (HIR::ExternCrate &crate);
   virtual void visit (HIR::UseDeclaration &use_decl);
@@ -95,6 +98,9 @@ private:
   Analysis::Mappings &mappings;
   Rust::Resolver::Resolver &resolver;
   DefId current_module;
+
+  /* Enclosing modules of the current one */
+  std::vector<DefId> module_stack;
 };
 
 } // namespace Privacy
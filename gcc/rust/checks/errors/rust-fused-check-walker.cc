@@ -0,0 +1,966 @@
+// Copyright (C) 2020-2023 Free Software Foundation, Inc.
+
+// This file is part of GCC.
+
+// GCC is free software; you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3, or (at your option) any later
+// version.
+
+// GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+// for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with GCC; see the file COPYING3.  If not see
+// <http://www.gnu.org/licenses/>.
+
+#include "rust-fused-check-walker.h"
+#include "rust-hir-expr.h"
+#include "rust-hir-stmt.h"
+#include "rust-hir-item.h"
+
+namespace Rust {
+namespace HIR {
+
+void
+FusedCheckWalker::add_pass (FusableCheckPass &pass)
+{
+  passes.push_back (&pass);
+}
+
+void
+FusedCheckWalker::go (Crate &crate)
+{
+  for (auto pass : passes)
+    pass->enter_crate (crate);
+
+  for (auto &item : crate.get_items ())
+    item->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (Lifetime &lifetime)
+{
+  visit_passes (lifetime);
+}
+
+void
+FusedCheckWalker::visit (LifetimeParam &lifetime_param)
+{
+  visit_passes (lifetime_param);
+}
+
+void
+FusedCheckWalker::visit (PathInExpression &path)
+{
+  visit_passes (path);
+}
+
+void
+FusedCheckWalker::visit (TypePathSegment &segment)
+{
+  visit_passes (segment);
+}
+
+void
+FusedCheckWalker::visit (TypePathSegmentGeneric &segment)
+{
+  visit_passes (segment);
+}
+
+void
+FusedCheckWalker::visit (TypePathSegmentFunction &segment)
+{
+  visit_passes (segment);
+}
+
+void
+FusedCheckWalker::visit (TypePath &path)
+{
+  visit_passes (path);
+}
+
+void
+FusedCheckWalker::visit (QualifiedPathInExpression &path)
+{
+  visit_passes (path);
+}
+
+void
+FusedCheckWalker::visit (QualifiedPathInType &path)
+{
+  visit_passes (path);
+}
+
+void
+FusedCheckWalker::visit (LiteralExpr &expr)
+{
+  visit_passes (expr);
+}
+
+void
+FusedCheckWalker::visit (BorrowExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (DereferenceExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ErrorPropagationExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (NegationExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ArithmeticOrLogicalExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_lhs ()->accept_vis (*this);
+  expr.get_rhs ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ComparisonExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_lhs ()->accept_vis (*this);
+  expr.get_rhs ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (LazyBooleanExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_lhs ()->accept_vis (*this);
+  expr.get_rhs ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (TypeCastExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (AssignmentExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_lhs ()->accept_vis (*this);
+  expr.get_rhs ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (CompoundAssignmentExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_lhs ()->accept_vis (*this);
+  expr.get_rhs ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (GroupedExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_expr_in_parens ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ArrayElemsValues &elems)
+{
+  visit_passes (elems);
+
+  for (auto &elem : elems.get_values ())
+    elem->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ArrayElemsCopied &elems)
+{
+  visit_passes (elems);
+
+  elems.get_elem_to_copy ()->accept_vis (*this);
+
+  for (auto pass : passes)
+    pass->enter_num_copies (elems);
+  elems.get_num_copies_expr ()->accept_vis (*this);
+  for (auto pass : passes)
+    pass->leave_num_copies (elems);
+}
+
+void
+FusedCheckWalker::visit (ArrayExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_internal_elements ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ArrayIndexExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_array_expr ()->accept_vis (*this);
+  expr.get_index_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (TupleExpr &expr)
+{
+  visit_passes (expr);
+
+  for (auto &elem : expr.get_tuple_elems ())
+    elem->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (TupleIndexExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_tuple_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (StructExprStruct &expr)
+{
+  visit_passes (expr);
+}
+
+void
+FusedCheckWalker::visit (StructExprFieldIdentifier &field)
+{
+  visit_passes (field);
+}
+
+void
+FusedCheckWalker::visit (StructExprFieldIdentifierValue &field)
+{
+  visit_passes (field);
+
+  field.get_value ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (StructExprFieldIndexValue &field)
+{
+  visit_passes (field);
+
+  field.get_value ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (StructExprStructFields &expr)
+{
+  visit_passes (expr);
+
+  for (auto &field : expr.get_fields ())
+    field->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (StructExprStructBase &expr)
+{
+  visit_passes (expr);
+}
+
+void
+FusedCheckWalker::visit (CallExpr &expr)
+{
+  visit_passes (expr);
+
+  if (expr.get_fnexpr ())
+    expr.get_fnexpr ()->accept_vis (*this);
+
+  for (auto &arg : expr.get_arguments ())
+    arg->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (MethodCallExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_receiver ()->accept_vis (*this);
+
+  for (auto &arg : expr.get_arguments ())
+    arg->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (FieldAccessExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_receiver_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ClosureExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (BlockExpr &expr)
+{
+  visit_passes (expr);
+
+  for (auto &stmt : expr.get_statements ())
+    stmt->accept_vis (*this);
+
+  if (expr.has_expr ())
+    expr.get_final_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ContinueExpr &expr)
+{
+  visit_passes (expr);
+}
+
+void
+FusedCheckWalker::visit (BreakExpr &expr)
+{
+  visit_passes (expr);
+
+  if (expr.has_break_expr ())
+    expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (RangeFromToExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_from_expr ()->accept_vis (*this);
+  expr.get_to_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (RangeFromExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_from_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (RangeToExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_to_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (RangeFullExpr &expr)
+{
+  visit_passes (expr);
+}
+
+void
+FusedCheckWalker::visit (RangeFromToInclExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_from_expr ()->accept_vis (*this);
+  expr.get_to_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (RangeToInclExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_to_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ReturnExpr &expr)
+{
+  visit_passes (expr);
+
+  if (expr.has_return_expr ())
+    expr.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (UnsafeBlockExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_block_expr ()->accept_vis (*this);
+
+  leave_passes (expr);
+}
+
+void
+FusedCheckWalker::visit (LoopExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_loop_block ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (WhileLoopExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_predicate_expr ()->accept_vis (*this);
+  expr.get_loop_block ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (WhileLetLoopExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_cond ()->accept_vis (*this);
+  expr.get_loop_block ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (IfExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_if_condition ()->accept_vis (*this);
+  expr.get_if_block ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (IfExprConseqElse &expr)
+{
+  visit_passes (expr);
+
+  expr.get_if_condition ()->accept_vis (*this);
+  expr.get_if_block ()->accept_vis (*this);
+  expr.get_else_block ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (IfLetExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_scrutinee_expr ()->accept_vis (*this);
+  expr.get_if_block ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (IfLetExprConseqElse &expr)
+{
+  visit_passes (expr);
+
+  expr.get_scrutinee_expr ()->accept_vis (*this);
+  expr.get_if_block ()->accept_vis (*this);
+
+  // TODO: Visit else expression
+}
+
+void
+FusedCheckWalker::visit (MatchExpr &expr)
+{
+  visit_passes (expr);
+
+  expr.get_scrutinee_expr ()->accept_vis (*this);
+
+  for (auto &match_arm : expr.get_match_cases ())
+    match_arm.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (AwaitExpr &expr)
+{
+  visit_passes (expr);
+
+  // TODO: Visit expression
+}
+
+void
+FusedCheckWalker::visit (AsyncBlockExpr &expr)
+{
+  visit_passes (expr);
+
+  // TODO: Visit block expression
+}
+
+void
+FusedCheckWalker::visit (TypeParam &param)
+{
+  visit_passes (param);
+}
+
+void
+FusedCheckWalker::visit (ConstGenericParam &param)
+{
+  visit_passes (param);
+}
+
+void
+FusedCheckWalker::visit (LifetimeWhereClauseItem &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (TypeBoundWhereClauseItem &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (Module &module)
+{
+  visit_passes (module);
+
+  for (auto &item : module.get_items ())
+    item->accept_vis (*this);
+
+  leave_passes (module);
+}
+
+void
+FusedCheckWalker::visit (ExternCrate &crate)
+{
+  visit_passes (crate);
+}
+
+void
+FusedCheckWalker::visit (UseTreeGlob &use_tree)
+{
+  visit_passes (use_tree);
+}
+
+void
+FusedCheckWalker::visit (UseTreeList &use_tree)
+{
+  visit_passes (use_tree);
+}
+
+void
+FusedCheckWalker::visit (UseTreeRebind &use_tree)
+{
+  visit_passes (use_tree);
+}
+
+void
+FusedCheckWalker::visit (UseDeclaration &use_decl)
+{
+  visit_passes (use_decl);
+}
+
+void
+FusedCheckWalker::visit (Function &function)
+{
+  visit_passes (function);
+
+  for (auto &param : function.get_function_params ())
+    param.get_type ()->accept_vis (*this);
+
+  function.get_definition ()->accept_vis (*this);
+
+  leave_passes (function);
+}
+
+void
+FusedCheckWalker::visit (TypeAlias &type_alias)
+{
+  visit_passes (type_alias);
+}
+
+void
+FusedCheckWalker::visit (StructStruct &struct_item)
+{
+  visit_passes (struct_item);
+}
+
+void
+FusedCheckWalker::visit (TupleStruct &tuple_struct)
+{
+  visit_passes (tuple_struct);
+}
+
+void
+FusedCheckWalker::visit (EnumItem &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (EnumItemTuple &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (EnumItemStruct &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (EnumItemDiscriminant &item)
+{
+  visit_passes (item);
+
+  item.get_discriminant_expression ()->accept_vis (*this);
+
+  leave_passes (item);
+}
+
+void
+FusedCheckWalker::visit (Enum &enum_item)
+{
+  visit_passes (enum_item);
+}
+
+void
+FusedCheckWalker::visit (Union &union_item)
+{
+  visit_passes (union_item);
+}
+
+void
+FusedCheckWalker::visit (ConstantItem &const_item)
+{
+  visit_passes (const_item);
+
+  const_item.get_expr ()->accept_vis (*this);
+
+  leave_passes (const_item);
+}
+
+void
+FusedCheckWalker::visit (StaticItem &static_item)
+{
+  visit_passes (static_item);
+
+  static_item.get_expr ()->accept_vis (*this);
+
+  leave_passes (static_item);
+}
+
+void
+FusedCheckWalker::visit (TraitItemFunc &item)
+{
+  visit_passes (item);
+
+  if (item.has_block_defined ())
+    item.get_block_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (TraitItemConst &item)
+{
+  visit_passes (item);
+
+  if (item.has_expr ())
+    item.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (TraitItemType &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (Trait &trait)
+{
+  visit_passes (trait);
+
+  for (auto &item : trait.get_trait_items ())
+    item->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ImplBlock &impl)
+{
+  visit_passes (impl);
+
+  for (auto &item : impl.get_impl_items ())
+    item->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ExternalStaticItem &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (ExternalFunctionItem &item)
+{
+  visit_passes (item);
+}
+
+void
+FusedCheckWalker::visit (ExternBlock &block)
+{
+  visit_passes (block);
+
+  for (auto &item : block.get_extern_items ())
+    item->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (LiteralPattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (IdentifierPattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (WildcardPattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (RangePatternBoundLiteral &bound)
+{
+  visit_passes (bound);
+}
+
+void
+FusedCheckWalker::visit (RangePatternBoundPath &bound)
+{
+  visit_passes (bound);
+}
+
+void
+FusedCheckWalker::visit (RangePatternBoundQualPath &bound)
+{
+  visit_passes (bound);
+}
+
+void
+FusedCheckWalker::visit (RangePattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (ReferencePattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (StructPatternFieldTuplePat &field)
+{
+  visit_passes (field);
+}
+
+void
+FusedCheckWalker::visit (StructPatternFieldIdentPat &field)
+{
+  visit_passes (field);
+}
+
+void
+FusedCheckWalker::visit (StructPatternFieldIdent &field)
+{
+  visit_passes (field);
+}
+
+void
+FusedCheckWalker::visit (StructPattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (TupleStructItemsNoRange &tuple_items)
+{
+  visit_passes (tuple_items);
+}
+
+void
+FusedCheckWalker::visit (TupleStructItemsRange &tuple_items)
+{
+  visit_passes (tuple_items);
+}
+
+void
+FusedCheckWalker::visit (TupleStructPattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (TuplePatternItemsMultiple &tuple_items)
+{
+  visit_passes (tuple_items);
+}
+
+void
+FusedCheckWalker::visit (TuplePatternItemsRanged &tuple_items)
+{
+  visit_passes (tuple_items);
+}
+
+void
+FusedCheckWalker::visit (TuplePattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (SlicePattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (AltPattern &pattern)
+{
+  visit_passes (pattern);
+}
+
+void
+FusedCheckWalker::visit (EmptyStmt &stmt)
+{
+  visit_passes (stmt);
+}
+
+void
+FusedCheckWalker::visit (LetStmt &stmt)
+{
+  visit_passes (stmt);
+
+  if (stmt.has_init_expr ())
+    stmt.get_init_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (ExprStmt &stmt)
+{
+  visit_passes (stmt);
+
+  stmt.get_expr ()->accept_vis (*this);
+}
+
+void
+FusedCheckWalker::visit (TraitBound &bound)
+{
+  visit_passes (bound);
+}
+
+void
+FusedCheckWalker::visit (ImplTraitType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (TraitObjectType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (ParenthesisedType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (ImplTraitTypeOneBound &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (TupleType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (NeverType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (RawPointerType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (ReferenceType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (ArrayType &type)
+{
+  visit_passes (type);
+
+  type.get_size_expr ()->accept_vis (*this);
+
+  leave_passes (type);
+}
+
+void
+FusedCheckWalker::visit (SliceType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (InferredType &type)
+{
+  visit_passes (type);
+}
+
+void
+FusedCheckWalker::visit (BareFunctionType &type)
+{
+  visit_passes (type);
+}
+
+} // namespace HIR
+} // namespace Rust
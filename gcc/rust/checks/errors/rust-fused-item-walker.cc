@@ -0,0 +1,63 @@
+// Copyright (C) 2020-2023 Free Software Foundation, Inc.
+
+// This file is part of GCC.
+
+// GCC is free software; you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3, or (at your option) any later
+// version.
+
+// GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+// for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with GCC; see the file COPYING3.  If not see
+// <http://www.gnu.org/licenses/>.
+
+#include "rust-fused-item-walker.h"
+
+namespace Rust {
+namespace HIR {
+
+void
+FusedItemWalker::add_pass (FusableItemPass &pass)
+{
+  passes.push_back (&pass);
+}
+
+void
+FusedItemWalker::go (Crate &crate)
+{
+  for (auto pass : passes)
+    pass->enter_crate (crate);
+
+  visit_items (crate.get_items ());
+}
+
+void
+FusedItemWalker::visit_items (std::vector<std::unique_ptr<Item>> &items)
+{
+  for (auto &item : items)
+    {
+      if (item->get_hir_kind () != Node::VIS_ITEM)
+	continue;
+
+      auto vis_item = static_cast<VisItem *> (item.get ());
+      for (auto pass : passes)
+	vis_item->accept_vis (*pass);
+
+      if (vis_item->get_item_kind () != Item::ItemKind::Module)
+	continue;
+
+      auto &mod = static_cast<Module &> (*vis_item);
+      visit_items (mod.get_items ());
+
+      for (auto pass : passes)
+	pass->exit_module (mod);
+    }
+}
+
+} // namespace HIR
+} // namespace Rust
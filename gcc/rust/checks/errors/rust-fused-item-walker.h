@@ -0,0 +1,75 @@
+// Copyright (C) 2020-2023 Free Software Foundation, Inc.
+
+// This file is part of GCC.
+
+// GCC is free software; you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3, or (at your option) any later
+// version.
+
+// GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+// for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with GCC; see the file COPYING3.  If not see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef RUST_FUSED_ITEM_WALKER_H
+#define RUST_FUSED_ITEM_WALKER_H
+
+#include "rust-hir-visitor.h"
+#include "rust-hir.h"
+#include "rust-hir-item.h"
+
+namespace Rust {
+namespace HIR {
+
+/**
+ * An item-level checking pass which can share its walk over the crate with
+ * other such passes. The pass only implements what to do for each item, as
+ * with any `HIRVisItemVisitor`, but must not visit the items of a module
+ * itself: the `FusedItemWalker` does so once for all of its passes, visiting
+ * a module before its items and calling `exit_module` after them.
+ */
+class FusableItemPass : public HIRVisItemVisitor
+{
+public:
+  virtual ~FusableItemPass () {}
+
+  /**
+   * Called once before any of the crate's items are visited
+   */
+  virtual void enter_crate (Crate &) {}
+
+  /**
+   * Called after all the items of a module have been visited
+   */
+  virtual void exit_module (Module &) {}
+};
+
+/**
+ * Walk the items of a crate once, running all the registered passes on each
+ * item in the order they were added. A pass therefore sees all the items
+ * before and above the current one already handled by the passes registered
+ * before it, but nothing more: passes which need the results of another pass
+ * for the whole crate must still run after it separately.
+ */
+class FusedItemWalker
+{
+public:
+  void add_pass (FusableItemPass &pass);
+
+  void go (Crate &crate);
+
+private:
+  void visit_items (std::vector<std::unique_ptr<Item>> &items);
+
+  std::vector<FusableItemPass *> passes;
+};
+
+} // namespace HIR
+} // namespace Rust
+
+#endif // !RUST_FUSED_ITEM_WALKER_H
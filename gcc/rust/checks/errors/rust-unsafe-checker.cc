@@ -35,8 +35,9 @@ UnsafeChecker::UnsafeChecker ()
 void
 UnsafeChecker::go (HIR::Crate &crate)
 {
-  for (auto &item : crate.get_items ())
-    item->accept_vis (*this);
+  FusedCheckWalker walker;
+  walker.add_pass (*this);
+  walker.go (crate);
 }
 
 static void
@@ -207,14 +208,6 @@ UnsafeChecker::check_function_attr (HirId node_id, location_t locus)
     check_target_attr (static_cast<Function *> (maybe_fn), locus);
 }
 
-void
-UnsafeChecker::visit (Lifetime &)
-{}
-
-void
-UnsafeChecker::visit (LifetimeParam &)
-{}
-
 void
 UnsafeChecker::visit (PathInExpression &path)
 {
@@ -230,40 +223,6 @@ UnsafeChecker::visit (PathInExpression &path)
   check_use_of_static (definition_id, path.get_locus ());
 }
 
-void
-UnsafeChecker::visit (TypePathSegment &)
-{}
-
-void
-UnsafeChecker::visit (TypePathSegmentGeneric &)
-{}
-
-void
-UnsafeChecker::visit (TypePathSegmentFunction &)
-{}
-
-void
-UnsafeChecker::visit (TypePath &)
-{}
-
-void
-UnsafeChecker::visit (QualifiedPathInExpression &)
-{}
-
-void
-UnsafeChecker::visit (QualifiedPathInType &)
-{}
-
-void
-UnsafeChecker::visit (LiteralExpr &)
-{}
-
-void
-UnsafeChecker::visit (BorrowExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
 void
 UnsafeChecker::visit (DereferenceExpr &expr)
 {
@@ -278,135 +237,6 @@ UnsafeChecker::visit (DereferenceExpr &expr)
 				      "unsafe function or block");
 }
 
-void
-UnsafeChecker::visit (ErrorPropagationExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (NegationExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ArithmeticOrLogicalExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ComparisonExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (LazyBooleanExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (TypeCastExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (AssignmentExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (CompoundAssignmentExpr &expr)
-{
-  expr.get_lhs ()->accept_vis (*this);
-  expr.get_rhs ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (GroupedExpr &expr)
-{
-  expr.get_expr_in_parens ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ArrayElemsValues &elems)
-{
-  for (auto &elem : elems.get_values ())
-    elem->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ArrayElemsCopied &elems)
-{
-  elems.get_elem_to_copy ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ArrayExpr &expr)
-{
-  expr.get_internal_elements ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ArrayIndexExpr &expr)
-{
-  expr.get_array_expr ()->accept_vis (*this);
-  expr.get_index_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (TupleExpr &expr)
-{
-  for (auto &elem : expr.get_tuple_elems ())
-    elem->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (TupleIndexExpr &expr)
-{
-  expr.get_tuple_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (StructExprStruct &)
-{}
-
-void
-UnsafeChecker::visit (StructExprFieldIdentifier &)
-{}
-
-void
-UnsafeChecker::visit (StructExprFieldIdentifierValue &field)
-{
-  field.get_value ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (StructExprFieldIndexValue &field)
-{
-  field.get_value ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (StructExprStructFields &expr)
-{
-  for (auto &field : expr.get_fields ())
-    field->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (StructExprStructBase &)
-{}
-
 void
 UnsafeChecker::visit (CallExpr &expr)
 {
@@ -432,10 +262,6 @@ UnsafeChecker::visit (CallExpr &expr)
   //     3. The function is marked with a target_feature attribute
   check_function_call (definition_id, expr.get_locus ());
   check_function_attr (definition_id, expr.get_locus ());
-
-  if (expr.has_params ())
-    for (auto &arg : expr.get_arguments ())
-      arg->accept_vis (*this);
 }
 
 void
@@ -451,18 +277,11 @@ UnsafeChecker::visit (MethodCallExpr &expr)
   if (!unsafe_context.is_in_context () && method)
     check_unsafe_call (static_cast<Function *> (method), expr.get_locus (),
 		       "method");
-
-  expr.get_receiver ()->accept_vis (*this);
-
-  for (auto &arg : expr.get_arguments ())
-    arg->accept_vis (*this);
 }
 
 void
 UnsafeChecker::visit (FieldAccessExpr &expr)
 {
-  expr.get_receiver_expr ()->accept_vis (*this);
-
   if (unsafe_context.is_in_context ())
     return;
 
@@ -481,464 +300,31 @@ UnsafeChecker::visit (FieldAccessExpr &expr)
     }
 }
 
-void
-UnsafeChecker::visit (ClosureExpr &expr)
-{
-  expr.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (BlockExpr &expr)
-{
-  for (auto &stmt : expr.get_statements ())
-    stmt->accept_vis (*this);
-
-  if (expr.has_expr ())
-    expr.get_final_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ContinueExpr &)
-{}
-
-void
-UnsafeChecker::visit (BreakExpr &expr)
-{
-  if (expr.has_break_expr ())
-    expr.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (RangeFromToExpr &expr)
-{
-  expr.get_from_expr ()->accept_vis (*this);
-  expr.get_to_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (RangeFromExpr &expr)
-{
-  expr.get_from_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (RangeToExpr &expr)
-{
-  expr.get_to_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (RangeFullExpr &)
-{}
-
-void
-UnsafeChecker::visit (RangeFromToInclExpr &expr)
-{
-  expr.get_from_expr ()->accept_vis (*this);
-  expr.get_to_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (RangeToInclExpr &expr)
-{
-  expr.get_to_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ReturnExpr &expr)
-{
-  if (expr.has_return_expr ())
-    expr.get_expr ()->accept_vis (*this);
-}
-
 void
 UnsafeChecker::visit (UnsafeBlockExpr &expr)
 {
   unsafe_context.enter (expr.get_mappings ().get_hirid ());
-
-  expr.get_block_expr ()->accept_vis (*this);
-
-  unsafe_context.exit ();
-}
-
-void
-UnsafeChecker::visit (LoopExpr &expr)
-{
-  expr.get_loop_block ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (WhileLoopExpr &expr)
-{
-  expr.get_predicate_expr ()->accept_vis (*this);
-  expr.get_loop_block ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (WhileLetLoopExpr &expr)
-{
-  expr.get_cond ()->accept_vis (*this);
-  expr.get_loop_block ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (IfExpr &expr)
-{
-  expr.get_if_condition ()->accept_vis (*this);
-  expr.get_if_block ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (IfExprConseqElse &expr)
-{
-  expr.get_if_condition ()->accept_vis (*this);
-  expr.get_if_block ()->accept_vis (*this);
-  expr.get_else_block ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (IfLetExpr &expr)
-{
-  expr.get_scrutinee_expr ()->accept_vis (*this);
-  expr.get_if_block ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (IfLetExprConseqElse &expr)
-{
-  expr.get_scrutinee_expr ()->accept_vis (*this);
-  expr.get_if_block ()->accept_vis (*this);
-
-  // TODO: Visit else expression
-}
-
-void
-UnsafeChecker::visit (MatchExpr &expr)
-{
-  expr.get_scrutinee_expr ()->accept_vis (*this);
-
-  for (auto &match_arm : expr.get_match_cases ())
-    match_arm.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (AwaitExpr &)
-{
-  // TODO: Visit expression
-}
-
-void
-UnsafeChecker::visit (AsyncBlockExpr &)
-{
-  // TODO: Visit block expression
 }
 
 void
-UnsafeChecker::visit (TypeParam &)
-{}
-
-void
-UnsafeChecker::visit (ConstGenericParam &)
-{}
-
-void
-UnsafeChecker::visit (LifetimeWhereClauseItem &)
-{}
-
-void
-UnsafeChecker::visit (TypeBoundWhereClauseItem &)
-{}
-
-void
-UnsafeChecker::visit (Module &module)
+UnsafeChecker::leave (UnsafeBlockExpr &)
 {
-  for (auto &item : module.get_items ())
-    item->accept_vis (*this);
+  unsafe_context.exit ();
 }
 
-void
-UnsafeChecker::visit (ExternCrate &)
-{}
-
-void
-UnsafeChecker::visit (UseTreeGlob &)
-{}
-
-void
-UnsafeChecker::visit (UseTreeList &)
-{}
-
-void
-UnsafeChecker::visit (UseTreeRebind &)
-{}
-
-void
-UnsafeChecker::visit (UseDeclaration &)
-{}
-
 void
 UnsafeChecker::visit (Function &function)
 {
-  auto is_unsafe_fn = function.get_qualifiers ().is_unsafe ();
-
-  if (is_unsafe_fn)
+  if (function.get_qualifiers ().is_unsafe ())
     unsafe_context.enter (function.get_mappings ().get_hirid ());
-
-  function.get_definition ()->accept_vis (*this);
-
-  if (is_unsafe_fn)
-    unsafe_context.exit ();
-}
-
-void
-UnsafeChecker::visit (TypeAlias &)
-{
-  // FIXME: What do we need to do to handle type aliasing? Is it possible to
-  // have unsafe types? Type aliases on unsafe functions?
-}
-
-void
-UnsafeChecker::visit (StructStruct &)
-{}
-
-void
-UnsafeChecker::visit (TupleStruct &)
-{}
-
-void
-UnsafeChecker::visit (EnumItem &)
-{}
-
-void
-UnsafeChecker::visit (EnumItemTuple &)
-{}
-
-void
-UnsafeChecker::visit (EnumItemStruct &)
-{}
-
-void
-UnsafeChecker::visit (EnumItemDiscriminant &)
-{}
-
-void
-UnsafeChecker::visit (Enum &)
-{}
-
-void
-UnsafeChecker::visit (Union &)
-{}
-
-void
-UnsafeChecker::visit (ConstantItem &const_item)
-{
-  const_item.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (StaticItem &static_item)
-{
-  static_item.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (TraitItemFunc &item)
-{
-  if (item.has_block_defined ())
-    item.get_block_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (TraitItemConst &item)
-{
-  if (item.has_expr ())
-    item.get_expr ()->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (TraitItemType &)
-{}
-
-void
-UnsafeChecker::visit (Trait &trait)
-{
-  // FIXME: Handle unsafe traits
-  for (auto &item : trait.get_trait_items ())
-    item->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ImplBlock &impl)
-{
-  // FIXME: Handle unsafe impls
-  for (auto &item : impl.get_impl_items ())
-    item->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (ExternalStaticItem &)
-{}
-
-void
-UnsafeChecker::visit (ExternalFunctionItem &)
-{}
-
-void
-UnsafeChecker::visit (ExternBlock &block)
-{
-  // FIXME: Do we need to do this?
-  for (auto &item : block.get_extern_items ())
-    item->accept_vis (*this);
-}
-
-void
-UnsafeChecker::visit (LiteralPattern &)
-{}
-
-void
-UnsafeChecker::visit (IdentifierPattern &)
-{}
-
-void
-UnsafeChecker::visit (WildcardPattern &)
-{}
-
-void
-UnsafeChecker::visit (RangePatternBoundLiteral &)
-{}
-
-void
-UnsafeChecker::visit (RangePatternBoundPath &)
-{}
-
-void
-UnsafeChecker::visit (RangePatternBoundQualPath &)
-{}
-
-void
-UnsafeChecker::visit (RangePattern &)
-{}
-
-void
-UnsafeChecker::visit (ReferencePattern &)
-{}
-
-void
-UnsafeChecker::visit (StructPatternFieldTuplePat &)
-{}
-
-void
-UnsafeChecker::visit (StructPatternFieldIdentPat &)
-{}
-
-void
-UnsafeChecker::visit (StructPatternFieldIdent &)
-{}
-
-void
-UnsafeChecker::visit (StructPattern &)
-{}
-
-void
-UnsafeChecker::visit (TupleStructItemsNoRange &)
-{}
-
-void
-UnsafeChecker::visit (TupleStructItemsRange &)
-{}
-
-void
-UnsafeChecker::visit (TupleStructPattern &)
-{}
-
-void
-UnsafeChecker::visit (TuplePatternItemsMultiple &)
-{}
-
-void
-UnsafeChecker::visit (TuplePatternItemsRanged &)
-{}
-
-void
-UnsafeChecker::visit (TuplePattern &)
-{}
-
-void
-UnsafeChecker::visit (SlicePattern &)
-{}
-
-void
-UnsafeChecker::visit (AltPattern &)
-{}
-
-void
-UnsafeChecker::visit (EmptyStmt &)
-{}
-
-void
-UnsafeChecker::visit (LetStmt &stmt)
-{
-  if (stmt.has_init_expr ())
-    stmt.get_init_expr ()->accept_vis (*this);
 }
 
 void
-UnsafeChecker::visit (ExprStmt &stmt)
+UnsafeChecker::leave (Function &function)
 {
-  stmt.get_expr ()->accept_vis (*this);
+  if (function.get_qualifiers ().is_unsafe ())
+    unsafe_context.exit ();
 }
 
-void
-UnsafeChecker::visit (TraitBound &)
-{}
-
-void
-UnsafeChecker::visit (ImplTraitType &)
-{}
-
-void
-UnsafeChecker::visit (TraitObjectType &)
-{}
-
-void
-UnsafeChecker::visit (ParenthesisedType &)
-{}
-
-void
-UnsafeChecker::visit (ImplTraitTypeOneBound &)
-{}
-
-void
-UnsafeChecker::visit (TupleType &)
-{}
-
-void
-UnsafeChecker::visit (NeverType &)
-{}
-
-void
-UnsafeChecker::visit (RawPointerType &)
-{}
-
-void
-UnsafeChecker::visit (ReferenceType &)
-{}
-
-void
-UnsafeChecker::visit (ArrayType &)
-{}
-
-void
-UnsafeChecker::visit (SliceType &)
-{}
-
-void
-UnsafeChecker::visit (InferredType &)
-{}
-
-void
-UnsafeChecker::visit (BareFunctionType &)
-{}
-
 } // namespace HIR
 } // namespace Rust
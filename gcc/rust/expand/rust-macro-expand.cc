@@ -77,6 +77,11 @@ MacroExpander::expand_decl_macro (location_t invoc_locus,
 
   AST::DelimTokenTree &invoc_token_tree = invoc.get_delim_tok_tree ();
 
+  // flatten the invocation once: every rule is matched against the same
+  // tokens, and the transcription refers back to them by offset
+  auto invoc_stream = invoc_token_tree.to_token_stream ();
+  auto invoc_tokens = MacroInvocLexer::share (invoc_stream);
+
   // find matching arm
   AST::MacroRule *matched_rule = nullptr;
   std::map<std::string, std::unique_ptr<MatchedFragmentContainer>>
@@ -84,7 +89,7 @@ MacroExpander::expand_decl_macro (location_t invoc_locus,
   for (auto &rule : rules_def.get_rules ())
     {
       sub_stack.push ();
-      bool did_match_rule = try_match_rule (rule, invoc_token_tree);
+      bool did_match_rule = try_match_rule (rule, invoc_tokens);
       matched_fragments = sub_stack.pop ();
 
       if (did_match_rule)
@@ -116,7 +121,7 @@ MacroExpander::expand_decl_macro (location_t invoc_locus,
   for (auto &ent : matched_fragments)
     matched_fragments_ptr.emplace (ent.first, ent.second.get ());
 
-  return transcribe_rule (*matched_rule, invoc_token_tree,
+  return transcribe_rule (*matched_rule, invoc_token_tree, invoc_stream,
 			  matched_fragments_ptr, semicolon, peek_context ());
 }
 
@@ -164,13 +169,7 @@ MacroExpander::expand_eager_invocations (AST::MacroInvocation &invoc)
   std::vector<std::unique_ptr<AST::TokenTree>> new_stream;
   size_t current_pending = 0;
 
-  // we need to create a clone of the delimited token tree as the lexer
-  // expects ownership of the tokens
-  std::vector<std::unique_ptr<Rust::AST::Token>> dtt_clone;
-  for (auto &tok : stream)
-    dtt_clone.emplace_back (tok->clone_token ());
-
-  MacroInvocLexer lex (std::move (dtt_clone));
+  MacroInvocLexer lex (stream);
   Parser<MacroInvocLexer> parser (lex);
 
   // we want to build a substitution map - basically, associating a `start` and
@@ -354,9 +353,9 @@ MacroExpander::depth_exceeds_recursion_limit () const
 
 bool
 MacroExpander::try_match_rule (AST::MacroRule &match_rule,
-			       AST::DelimTokenTree &invoc_token_tree)
+			       const SharedTokenStream &invoc_tokens)
 {
-  MacroInvocLexer lex (invoc_token_tree.to_token_stream ());
+  MacroInvocLexer lex (invoc_tokens);
   Parser<MacroInvocLexer> parser (lex);
 
   AST::MacroMatcher &matcher = match_rule.get_matcher ();
@@ -1014,6 +1013,7 @@ tokens_to_str (std::vector<std::unique_ptr<AST::Token>> &tokens)
 AST::Fragment
 MacroExpander::transcribe_rule (
   AST::MacroRule &match_rule, AST::DelimTokenTree &invoc_token_tree,
+  std::vector<std::unique_ptr<AST::Token>> &invoc_stream,
   std::map<std::string, MatchedFragmentContainer *> &matched_fragments,
   bool semicolon, ContextType ctx)
 {
@@ -1022,7 +1022,6 @@ MacroExpander::transcribe_rule (
   AST::MacroTranscriber &transcriber = match_rule.get_transcriber ();
   AST::DelimTokenTree &transcribe_tree = transcriber.get_token_tree ();
 
-  auto invoc_stream = invoc_token_tree.to_token_stream ();
   auto macro_rule_tokens = transcribe_tree.to_token_stream ();
 
   auto substitute_context
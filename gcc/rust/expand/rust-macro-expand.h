@@ -327,10 +327,11 @@ struct MacroExpander
   bool depth_exceeds_recursion_limit () const;
 
   bool try_match_rule (AST::MacroRule &match_rule,
-		       AST::DelimTokenTree &invoc_token_tree);
+		       const SharedTokenStream &invoc_tokens);
 
   AST::Fragment transcribe_rule (
     AST::MacroRule &match_rule, AST::DelimTokenTree &invoc_token_tree,
+    std::vector<std::unique_ptr<AST::Token>> &invoc_stream,
     std::map<std::string, MatchedFragmentContainer *> &matched_fragments,
     bool semicolon, ContextType ctx);
 
@@ -21,32 +21,42 @@
 
 namespace Rust {
 
+SharedTokenStream
+MacroInvocLexer::share (const std::vector<std::unique_ptr<AST::Token>> &stream)
+{
+  auto tokens = std::make_shared<std::vector<const_TokenPtr>> ();
+  tokens->reserve (stream.size ());
+  for (auto &tok : stream)
+    tokens->push_back (tok->get_tok_ptr ());
+
+  return tokens;
+}
+
 const_TokenPtr
 MacroInvocLexer::peek_token (int n)
 {
-  if ((offs + n) >= token_stream.size ())
+  if ((offs + n) >= token_stream->size ())
     return Token::make (END_OF_FILE, UNDEF_LOCATION);
 
-  return token_stream.at (offs + n)->get_tok_ptr ();
+  return token_stream->at (offs + n);
 }
 
 void
 MacroInvocLexer::split_current_token (TokenId new_left, TokenId new_right)
 {
-  auto &current_token = token_stream.at (offs);
-  auto current_pos = token_stream.begin () + offs;
+  auto &stream = get_mutable_stream ();
+  auto &current_token = stream.at (offs);
+  auto current_pos = stream.begin () + offs;
 
   auto l_tok = Token::make (new_left, current_token->get_locus ());
   auto r_tok = Token::make (new_right, current_token->get_locus ());
 
-  token_stream.erase (current_pos);
+  stream.erase (current_pos);
 
   // `insert` inserts before the specified position, so we insert the right one
   // then the left
-  token_stream.insert (current_pos,
-		       std::unique_ptr<AST::Token> (new AST::Token (r_tok)));
-  token_stream.insert (current_pos,
-		       std::unique_ptr<AST::Token> (new AST::Token (l_tok)));
+  stream.insert (current_pos, r_tok);
+  stream.insert (current_pos, l_tok);
 }
 
 void
@@ -54,14 +64,14 @@ MacroInvocLexer::split_current_token (std::vector<TokenPtr> new_tokens)
 {
   rust_assert (new_tokens.size () > 0);
 
-  auto current_pos = token_stream.begin () + offs;
+  auto &stream = get_mutable_stream ();
+  auto current_pos = stream.begin () + offs;
 
-  token_stream.erase (current_pos);
+  stream.erase (current_pos);
 
   for (size_t i = 1; i < new_tokens.size (); i++)
     {
-      token_stream.insert (current_pos + i, std::unique_ptr<AST::Token> (
-					      new AST::Token (new_tokens[i])));
+      stream.insert (current_pos + i, new_tokens[i]);
     }
 }
 
@@ -70,10 +80,10 @@ MacroInvocLexer::get_token_slice (size_t start_idx, size_t end_idx) const
 {
   std::vector<std::unique_ptr<AST::Token>> slice;
 
-  rust_assert (end_idx < token_stream.size ());
+  rust_assert (end_idx < token_stream->size ());
 
   for (size_t i = start_idx; i < end_idx; i++)
-    slice.emplace_back (token_stream[i]->clone_token ());
+    slice.emplace_back (new AST::Token ((*token_stream)[i]));
 
   return slice;
 }
@@ -26,6 +26,14 @@ template <class T> class MacroInvocLexerBase
 {
 public:
   MacroInvocLexerBase (std::vector<T> stream)
+    : offs (0),
+      token_stream (std::make_shared<std::vector<T>> (std::move (stream)))
+  {}
+
+  /* Reads from STREAM without copying it. STREAM is shared with whoever else
+   * holds it and is only copied if this lexer has to split one of its
+   * tokens. */
+  MacroInvocLexerBase (std::shared_ptr<std::vector<T>> stream)
     : offs (0), token_stream (std::move (stream))
   {}
 
@@ -46,16 +54,38 @@ public:
 
 protected:
   size_t offs;
-  std::vector<T> token_stream;
+  std::shared_ptr<std::vector<T>> token_stream;
+
+  // Returns the stream for modification, first copying it if it is shared.
+  std::vector<T> &get_mutable_stream ()
+  {
+    if (token_stream.use_count () > 1)
+      token_stream = std::make_shared<std::vector<T>> (*token_stream);
+
+    return *token_stream;
+  }
 };
 
-class MacroInvocLexer : public MacroInvocLexerBase<std::unique_ptr<AST::Token>>
+/* A flattened token tree which several lexers can read from at once, such as
+ * the tokens of a macro invocation while each of the macro's rules is tried
+ * against them. */
+using SharedTokenStream = std::shared_ptr<std::vector<const_TokenPtr>>;
+
+class MacroInvocLexer : public MacroInvocLexerBase<const_TokenPtr>
 {
 public:
-  MacroInvocLexer (std::vector<std::unique_ptr<AST::Token>> stream)
+  MacroInvocLexer (const std::vector<std::unique_ptr<AST::Token>> &stream)
+    : MacroInvocLexerBase (share (stream))
+  {}
+
+  MacroInvocLexer (SharedTokenStream stream)
     : MacroInvocLexerBase (std::move (stream))
   {}
 
+  // Flattens STREAM into lexer tokens which can be shared between lexers.
+  static SharedTokenStream
+  share (const std::vector<std::unique_ptr<AST::Token>> &stream);
+
   // Returns token n tokens ahead of current position.
   const_TokenPtr peek_token (int n);
 
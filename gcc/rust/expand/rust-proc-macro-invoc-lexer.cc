@@ -24,27 +24,28 @@ namespace Rust {
 const_TokenPtr
 ProcMacroInvocLexer::peek_token (int n)
 {
-  if ((offs + n) >= token_stream.size ())
+  if ((offs + n) >= token_stream->size ())
     return Token::make (END_OF_FILE, UNDEF_LOCATION);
 
-  return token_stream.at (offs + n);
+  return token_stream->at (offs + n);
 }
 
 void
 ProcMacroInvocLexer::split_current_token (TokenId new_left, TokenId new_right)
 {
-  auto &current_token = token_stream.at (offs);
-  auto current_pos = token_stream.begin () + offs;
+  auto &stream = get_mutable_stream ();
+  auto &current_token = stream.at (offs);
+  auto current_pos = stream.begin () + offs;
 
   auto l_tok = Token::make (new_left, current_token->get_locus ());
   auto r_tok = Token::make (new_right, current_token->get_locus ());
 
-  token_stream.erase (current_pos);
+  stream.erase (current_pos);
 
   // `insert` inserts before the specified position, so we insert the right one
   // then the left
-  token_stream.insert (current_pos, l_tok);
-  token_stream.insert (current_pos, r_tok);
+  stream.insert (current_pos, l_tok);
+  stream.insert (current_pos, r_tok);
 }
 
 void
@@ -52,13 +53,14 @@ ProcMacroInvocLexer::split_current_token (std::vector<TokenPtr> new_tokens)
 {
   rust_assert (new_tokens.size () > 0);
 
-  auto current_pos = token_stream.begin () + offs;
+  auto &stream = get_mutable_stream ();
+  auto current_pos = stream.begin () + offs;
 
-  token_stream.erase (current_pos);
+  stream.erase (current_pos);
 
   for (size_t i = 1; i < new_tokens.size (); i++)
     {
-      token_stream.insert (current_pos + i, new_tokens[i]);
+      stream.insert (current_pos + i, new_tokens[i]);
     }
 }
 
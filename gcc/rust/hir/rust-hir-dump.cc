@@ -91,7 +91,9 @@ Dump::go (HIR::Crate &e)
   end ("Crate");
 }
 
-Dump::Dump (std::ostream &stream) : stream (stream) {}
+Dump::Dump (std::ostream &stream, bool print_mappings)
+  : print_mappings (print_mappings), beg_of_line (true), stream (stream)
+{}
 
 /**
  * Writes TEXT with a final newline if ENDLINE is true.
@@ -389,6 +391,9 @@ Dump::do_operatorexpr (OperatorExpr &e)
 void
 Dump::do_mappings (const Analysis::NodeMapping &mappings)
 {
+  if (!print_mappings)
+    return;
+
   put ("mapping: ", false);
   put (mappings.as_string ());
 }
@@ -34,10 +34,13 @@ class Dump : public HIRFullVisitor
 public:
   static void debug (FullVisitable &v);
 
-  Dump (std::ostream &stream);
+  /* With PRINT_MAPPINGS false, node mappings are left out so that the
+   * output only depends on the structure of the dumped nodes. */
+  Dump (std::ostream &stream, bool print_mappings = true);
   void go (HIR::Crate &crate);
 
 private:
+  bool print_mappings;
   bool beg_of_line;
   Indent indentation;
   std::ostream &stream;
@@ -0,0 +1,1585 @@
+// Copyright (C) 2020-2023 Free Software Foundation, Inc.
+
+// This file is part of GCC.
+
+// GCC is free software; you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3, or (at your option) any later
+// version.
+
+// GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+// for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with GCC; see the file COPYING3.  If not see
+// <http://www.gnu.org/licenses/>.
+#include "rust-hir-fingerprint.h"
+#include "rust-hir-map.h"
+#include "rust-hir-type-check.h"
+#include "rust-name-resolver.h"
+#include "rust-make-unique.h"
+#include "selftest.h"
+
+namespace Rust {
+namespace HIR {
+
+/* The canonical path of the module a `pub(in path)` restriction refers to,
+ * as the restriction only carries the mappings of its path. */
+static std::string
+restriction_path (const SimplePath &path)
+{
+  auto mappings = Analysis::Mappings::get ();
+
+  NodeId ref = UNKNOWN_NODEID;
+  if (!Resolver::Resolver::get ()->lookup_resolved_name (
+	path.get_mappings ().get_nodeid (), &ref))
+    return "";
+
+  // the crate root is the only module without a canonical path
+  const Resolver::CanonicalPath *canonical = nullptr;
+  if (!mappings->lookup_canonical_path (ref, &canonical))
+    return mappings->get_current_crate_name ();
+
+  return canonical->get ();
+}
+
+/**
+ * Feeds the structure of the nodes it visits to a hasher: the kind of each
+ * node, then its names, literals and flags, then its children in order.
+ * Optional children are preceded by whether they are present and lists by
+ * their length, so that two different trees never feed the same sequence.
+ * Mappings and locations are never fed.
+ */
+class StructuralHasher : public HIRFullVisitor
+{
+public:
+  StructuralHasher (Hash::StableHasher &hasher) : hasher (hasher) {}
+
+  void visit (Lifetime &lifetime) override
+  {
+    kind ("Lifetime");
+    write_enum (lifetime.get_lifetime_type ());
+    hasher.write_str (lifetime.get_name ());
+  }
+
+  void visit (LifetimeParam &param) override
+  {
+    kind ("LifetimeParam");
+    hash_attr (param.get_outer_attribute ());
+    param.get_lifetime ().accept_vis (*this);
+    visit_all (param.get_lifetime_bounds ());
+  }
+
+  void visit (PathInExpression &path) override
+  {
+    kind ("PathInExpression");
+    hash_expr (path);
+    hasher.write_u8 (path.opening_scope_resolution ());
+    hash_path_segments (path);
+  }
+
+  void visit (TypePathSegment &segment) override
+  {
+    kind ("TypePathSegment");
+    hash_type_path_segment (segment);
+  }
+
+  void visit (TypePathSegmentGeneric &segment) override
+  {
+    kind ("TypePathSegmentGeneric");
+    hash_type_path_segment (segment);
+    hasher.write_u8 (segment.has_generic_args ());
+    if (segment.has_generic_args ())
+      hash_generic_args (segment.get_generic_args ());
+  }
+
+  void visit (TypePathSegmentFunction &segment) override
+  {
+    kind ("TypePathSegmentFunction");
+    hash_type_path_segment (segment);
+    TypePathFunction &function = segment.get_function_path ();
+    visit_all (function.get_params ());
+    visit_opt (function.get_return_type ());
+  }
+
+  void visit (TypePath &path) override
+  {
+    kind ("TypePath");
+    hasher.write_u8 (path.has_opening_scope_resolution_op ());
+    visit_all (path.get_segments ());
+  }
+
+  void visit (QualifiedPathInExpression &path) override
+  {
+    kind ("QualifiedPathInExpression");
+    hash_expr (path);
+    hash_qualified_path_type (path.get_path_type ());
+    hash_path_segments (path);
+  }
+
+  void visit (QualifiedPathInType &path) override
+  {
+    kind ("QualifiedPathInType");
+    hash_qualified_path_type (path.get_path_type ());
+    path.get_associated_segment ()->accept_vis (*this);
+    visit_all (path.get_segments ());
+  }
+
+  void visit (LiteralExpr &expr) override
+  {
+    kind ("LiteralExpr");
+    hash_expr (expr);
+    hash_literal (expr.get_literal ());
+  }
+
+  void visit (BorrowExpr &expr) override
+  {
+    kind ("BorrowExpr");
+    hash_expr (expr);
+    write_enum (expr.get_mut ());
+    visit_opt (expr.get_expr ());
+  }
+
+  void visit (DereferenceExpr &expr) override
+  {
+    kind ("DereferenceExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_expr ());
+  }
+
+  void visit (ErrorPropagationExpr &expr) override
+  {
+    kind ("ErrorPropagationExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_expr ());
+  }
+
+  void visit (NegationExpr &expr) override
+  {
+    kind ("NegationExpr");
+    hash_expr (expr);
+    write_enum (expr.get_expr_type ());
+    visit_opt (expr.get_expr ());
+  }
+
+  void visit (ArithmeticOrLogicalExpr &expr) override
+  {
+    kind ("ArithmeticOrLogicalExpr");
+    hash_expr (expr);
+    write_enum (expr.get_expr_type ());
+    visit_opt (expr.get_lhs ());
+    visit_opt (expr.get_rhs ());
+  }
+
+  void visit (ComparisonExpr &expr) override
+  {
+    kind ("ComparisonExpr");
+    hash_expr (expr);
+    write_enum (expr.get_expr_type ());
+    visit_opt (expr.get_lhs ());
+    visit_opt (expr.get_rhs ());
+  }
+
+  void visit (LazyBooleanExpr &expr) override
+  {
+    kind ("LazyBooleanExpr");
+    hash_expr (expr);
+    write_enum (expr.get_expr_type ());
+    visit_opt (expr.get_lhs ());
+    visit_opt (expr.get_rhs ());
+  }
+
+  void visit (TypeCastExpr &expr) override
+  {
+    kind ("TypeCastExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_expr ());
+    visit_opt (expr.get_type_to_convert_to ());
+  }
+
+  void visit (AssignmentExpr &expr) override
+  {
+    kind ("AssignmentExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_lhs ());
+    visit_opt (expr.get_rhs ());
+  }
+
+  void visit (CompoundAssignmentExpr &expr) override
+  {
+    kind ("CompoundAssignmentExpr");
+    hash_expr (expr);
+    write_enum (expr.get_expr_type ());
+    visit_opt (expr.get_lhs ());
+    visit_opt (expr.get_rhs ());
+  }
+
+  void visit (GroupedExpr &expr) override
+  {
+    kind ("GroupedExpr");
+    hash_expr (expr);
+    hash_attrs (expr.get_inner_attrs ());
+    visit_opt (expr.get_expr_in_parens ());
+  }
+
+  void visit (ArrayElemsValues &elems) override
+  {
+    kind ("ArrayElemsValues");
+    visit_all (elems.get_values ());
+  }
+
+  void visit (ArrayElemsCopied &elems) override
+  {
+    kind ("ArrayElemsCopied");
+    visit_opt (elems.get_elem_to_copy ());
+    visit_opt (elems.get_num_copies_expr ());
+  }
+
+  void visit (ArrayExpr &expr) override
+  {
+    kind ("ArrayExpr");
+    hash_expr (expr);
+    hash_attrs (expr.get_inner_attrs ());
+    visit_opt (expr.get_internal_elements ());
+  }
+
+  void visit (ArrayIndexExpr &expr) override
+  {
+    kind ("ArrayIndexExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_array_expr ());
+    visit_opt (expr.get_index_expr ());
+  }
+
+  void visit (TupleExpr &expr) override
+  {
+    kind ("TupleExpr");
+    hash_expr (expr);
+    hash_attrs (expr.get_inner_attrs ());
+    visit_all (expr.get_tuple_elems ());
+  }
+
+  void visit (TupleIndexExpr &expr) override
+  {
+    kind ("TupleIndexExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_tuple_expr ());
+    hasher.write_u64 (expr.get_tuple_index ());
+  }
+
+  void visit (StructExprStruct &expr) override
+  {
+    kind ("StructExprStruct");
+    hash_struct_expr (expr);
+  }
+
+  void visit (StructExprFieldIdentifier &field) override
+  {
+    kind ("StructExprFieldIdentifier");
+    hash_ident (field.get_field_name ());
+  }
+
+  void visit (StructExprFieldIdentifierValue &field) override
+  {
+    kind ("StructExprFieldIdentifierValue");
+    hash_ident (field.get_field_name ());
+    visit_opt (field.get_value ());
+  }
+
+  void visit (StructExprFieldIndexValue &field) override
+  {
+    kind ("StructExprFieldIndexValue");
+    hasher.write_u64 (field.get_tuple_index ());
+    visit_opt (field.get_value ());
+  }
+
+  void visit (StructExprStructFields &expr) override
+  {
+    kind ("StructExprStructFields");
+    hash_struct_expr (expr);
+    visit_all (expr.get_fields ());
+    hasher.write_u8 (expr.has_struct_base ());
+    if (expr.has_struct_base ())
+      expr.get_struct_base ()->get_base ()->accept_vis (*this);
+  }
+
+  void visit (StructExprStructBase &expr) override
+  {
+    kind ("StructExprStructBase");
+    hash_struct_expr (expr);
+    expr.get_struct_base ()->get_base ()->accept_vis (*this);
+  }
+
+  void visit (CallExpr &expr) override
+  {
+    kind ("CallExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_fnexpr ());
+    visit_all (expr.get_arguments ());
+  }
+
+  void visit (MethodCallExpr &expr) override
+  {
+    kind ("MethodCallExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_receiver ());
+    hash_path_segment (expr.get_method_name ());
+    visit_all (expr.get_arguments ());
+  }
+
+  void visit (FieldAccessExpr &expr) override
+  {
+    kind ("FieldAccessExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_receiver_expr ());
+    hash_ident (expr.get_field_name ());
+  }
+
+  void visit (ClosureExpr &expr) override
+  {
+    kind ("ClosureExpr");
+    hash_expr (expr);
+    hasher.write_u8 (expr.get_has_move ());
+    hasher.write_u64 (expr.get_params ().size ());
+    for (auto &param : expr.get_params ())
+      {
+	hash_attrs (param.get_outer_attrs ());
+	visit_opt (param.get_pattern ());
+	visit_opt (param.get_type ());
+      }
+    visit_opt (expr.get_return_type ());
+    visit_opt (expr.get_expr ());
+  }
+
+  void visit (BlockExpr &expr) override
+  {
+    kind ("BlockExpr");
+    hash_expr (expr);
+    hash_attrs (expr.get_inner_attrs ());
+    hasher.write_u8 (expr.has_label ());
+    if (expr.has_label ())
+      expr.get_label ().get_lifetime ().accept_vis (*this);
+    visit_all (expr.get_statements ());
+    visit_opt (expr.get_final_expr ());
+  }
+
+  void visit (ContinueExpr &expr) override
+  {
+    kind ("ContinueExpr");
+    hash_expr (expr);
+    hasher.write_u8 (expr.has_label ());
+    if (expr.has_label ())
+      expr.get_label ().accept_vis (*this);
+  }
+
+  void visit (BreakExpr &expr) override
+  {
+    kind ("BreakExpr");
+    hash_expr (expr);
+    hasher.write_u8 (expr.has_label ());
+    if (expr.has_label ())
+      expr.get_label ().accept_vis (*this);
+    visit_opt (expr.get_expr ());
+  }
+
+  void visit (RangeFromToExpr &expr) override
+  {
+    kind ("RangeFromToExpr");
+    visit_opt (expr.get_from_expr ());
+    visit_opt (expr.get_to_expr ());
+  }
+
+  void visit (RangeFromExpr &expr) override
+  {
+    kind ("RangeFromExpr");
+    visit_opt (expr.get_from_expr ());
+  }
+
+  void visit (RangeToExpr &expr) override
+  {
+    kind ("RangeToExpr");
+    visit_opt (expr.get_to_expr ());
+  }
+
+  void visit (RangeFullExpr &) override { kind ("RangeFullExpr"); }
+
+  void visit (RangeFromToInclExpr &expr) override
+  {
+    kind ("RangeFromToInclExpr");
+    visit_opt (expr.get_from_expr ());
+    visit_opt (expr.get_to_expr ());
+  }
+
+  void visit (RangeToInclExpr &expr) override
+  {
+    kind ("RangeToInclExpr");
+    visit_opt (expr.get_to_expr ());
+  }
+
+  void visit (ReturnExpr &expr) override
+  {
+    kind ("ReturnExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_expr ());
+  }
+
+  void visit (UnsafeBlockExpr &expr) override
+  {
+    kind ("UnsafeBlockExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_block_expr ());
+  }
+
+  void visit (LoopExpr &expr) override
+  {
+    kind ("LoopExpr");
+    hash_loop (expr);
+  }
+
+  void visit (WhileLoopExpr &expr) override
+  {
+    kind ("WhileLoopExpr");
+    hash_loop (expr);
+    visit_opt (expr.get_predicate_expr ());
+  }
+
+  void visit (WhileLetLoopExpr &expr) override
+  {
+    kind ("WhileLetLoopExpr");
+    hash_loop (expr);
+    visit_all (expr.get_patterns ());
+    visit_opt (expr.get_cond ());
+  }
+
+  void visit (IfExpr &expr) override
+  {
+    kind ("IfExpr");
+    hash_if (expr);
+  }
+
+  void visit (IfExprConseqElse &expr) override
+  {
+    kind ("IfExprConseqElse");
+    hash_if (expr);
+    visit_opt (expr.get_else_block ());
+  }
+
+  void visit (IfLetExpr &expr) override
+  {
+    kind ("IfLetExpr");
+    hash_if_let (expr);
+  }
+
+  void visit (IfLetExprConseqElse &expr) override
+  {
+    kind ("IfLetExprConseqElse");
+    hash_if_let (expr);
+    visit_opt (expr.get_else_block ());
+  }
+
+  void visit (MatchExpr &expr) override
+  {
+    kind ("MatchExpr");
+    hash_expr (expr);
+    hash_attrs (expr.get_inner_attrs ());
+    visit_opt (expr.get_scrutinee_expr ());
+    hasher.write_u64 (expr.get_match_cases ().size ());
+    for (auto &match_case : expr.get_match_cases ())
+      {
+	visit_all (match_case.get_arm ().get_patterns ());
+	visit_opt (match_case.get_arm ().get_guard_expr ());
+	visit_opt (match_case.get_expr ());
+      }
+  }
+
+  void visit (AwaitExpr &expr) override
+  {
+    kind ("AwaitExpr");
+    hash_expr (expr);
+    visit_opt (expr.get_awaited_expr ());
+  }
+
+  void visit (AsyncBlockExpr &expr) override
+  {
+    kind ("AsyncBlockExpr");
+    hash_expr (expr);
+    hasher.write_u8 (expr.get_has_move ());
+    visit_opt (expr.get_block_expr ());
+  }
+
+  void visit (TypeParam &param) override
+  {
+    kind ("TypeParam");
+    hash_attr (param.get_outer_attribute ());
+    hash_ident (param.get_type_representation ());
+    visit_all (param.get_type_param_bounds ());
+    visit_opt (param.get_type ());
+  }
+
+  void visit (ConstGenericParam &param) override
+  {
+    kind ("ConstGenericParam");
+    hasher.write_str (param.get_name ());
+    visit_opt (param.get_type ());
+    visit_opt (param.get_default_expression ());
+  }
+
+  void visit (LifetimeWhereClauseItem &item) override
+  {
+    kind ("LifetimeWhereClauseItem");
+    item.get_lifetime ().accept_vis (*this);
+    visit_all (item.get_lifetime_bounds ());
+  }
+
+  void visit (TypeBoundWhereClauseItem &item) override
+  {
+    kind ("TypeBoundWhereClauseItem");
+    visit_all (item.get_for_lifetimes ());
+    visit_opt (item.get_bound_type ());
+    visit_all (item.get_type_param_bounds ());
+  }
+
+  void visit (Module &module) override
+  {
+    kind ("Module");
+    hash_vis_item (module);
+    hash_attrs (module.get_inner_attrs ());
+    hash_ident (module.get_module_name ());
+    visit_all (module.get_items ());
+  }
+
+  void visit (ExternCrate &crate) override
+  {
+    kind ("ExternCrate");
+    hash_vis_item (crate);
+    hasher.write_str (crate.get_referenced_crate ());
+    hasher.write_str (crate.get_as_clause_name ());
+  }
+
+  void visit (UseTreeGlob &use_tree) override
+  {
+    kind ("UseTreeGlob");
+    write_enum (use_tree.get_glob_type ());
+    if (use_tree.get_glob_type () == UseTreeGlob::PathType::PATH_PREFIXED)
+      hasher.write_str (use_tree.get_path ().as_string ());
+  }
+
+  void visit (UseTreeList &use_tree) override
+  {
+    kind ("UseTreeList");
+    write_enum (use_tree.get_path_type ());
+    if (use_tree.get_path_type () == UseTreeList::PathType::PATH_PREFIXED)
+      hasher.write_str (use_tree.get_path ().as_string ());
+    visit_all (use_tree.get_trees ());
+  }
+
+  void visit (UseTreeRebind &use_tree) override
+  {
+    kind ("UseTreeRebind");
+    hasher.write_str (use_tree.get_path ().as_string ());
+    write_enum (use_tree.get_bind_type ());
+    hash_ident (use_tree.get_identifier ());
+  }
+
+  void visit (UseDeclaration &use_decl) override
+  {
+    kind ("UseDeclaration");
+    hash_vis_item (use_decl);
+    visit_opt (use_decl.get_use_tree ());
+  }
+
+  void visit (Function &function) override
+  {
+    kind ("Function");
+    hash_vis_item (function);
+    hash_qualifiers (function.get_qualifiers ());
+    hash_ident (function.get_function_name ());
+    visit_all (function.get_generic_params ());
+    hash_self_param (function.get_self_param ());
+    hash_function_params (function.get_function_params ());
+    visit_opt (function.get_return_type ());
+    visit_all (function.get_where_clause ().get_items ());
+    visit_opt (function.get_definition ());
+  }
+
+  void visit (TypeAlias &type_alias) override
+  {
+    kind ("TypeAlias");
+    hash_vis_item (type_alias);
+    hash_ident (type_alias.get_new_type_name ());
+    visit_all (type_alias.get_generic_params ());
+    visit_all (type_alias.get_where_clause ().get_items ());
+    visit_opt (type_alias.get_type_aliased ());
+  }
+
+  void visit (StructStruct &struct_item) override
+  {
+    kind ("StructStruct");
+    hash_struct (struct_item);
+    hasher.write_u8 (struct_item.is_unit_struct ());
+    hash_struct_fields (struct_item.get_fields ());
+  }
+
+  void visit (TupleStruct &tuple_struct) override
+  {
+    kind ("TupleStruct");
+    hash_struct (tuple_struct);
+    hash_tuple_fields (tuple_struct.get_fields ());
+  }
+
+  void visit (EnumItem &item) override
+  {
+    kind ("EnumItem");
+    hash_enum_item (item);
+  }
+
+  void visit (EnumItemTuple &item) override
+  {
+    kind ("EnumItemTuple");
+    hash_enum_item (item);
+    hash_tuple_fields (item.get_tuple_fields ());
+  }
+
+  void visit (EnumItemStruct &item) override
+  {
+    kind ("EnumItemStruct");
+    hash_enum_item (item);
+    hash_struct_fields (item.get_struct_fields ());
+  }
+
+  void visit (EnumItemDiscriminant &item) override
+  {
+    kind ("EnumItemDiscriminant");
+    hash_enum_item (item);
+    visit_opt (item.get_discriminant_expression ());
+  }
+
+  void visit (Enum &enum_item) override
+  {
+    kind ("Enum");
+    hash_vis_item (enum_item);
+    hash_ident (enum_item.get_identifier ());
+    visit_all (enum_item.get_generic_params ());
+    visit_all (enum_item.get_where_clause ().get_items ());
+    visit_all (enum_item.get_variants ());
+  }
+
+  void visit (Union &union_item) override
+  {
+    kind ("Union");
+    hash_vis_item (union_item);
+    hash_ident (union_item.get_identifier ());
+    visit_all (union_item.get_generic_params ());
+    visit_all (union_item.get_where_clause ().get_items ());
+    hash_struct_fields (union_item.get_variants ());
+  }
+
+  void visit (ConstantItem &const_item) override
+  {
+    kind ("ConstantItem");
+    hash_vis_item (const_item);
+    hash_ident (const_item.get_identifier ());
+    visit_opt (const_item.get_type ());
+    visit_opt (const_item.get_expr ());
+  }
+
+  void visit (StaticItem &static_item) override
+  {
+    kind ("StaticItem");
+    hash_vis_item (static_item);
+    hasher.write_u8 (static_item.is_mut ());
+    hash_ident (static_item.get_identifier ());
+    visit_opt (static_item.get_type ());
+    visit_opt (static_item.get_expr ());
+  }
+
+  void visit (TraitItemFunc &item) override
+  {
+    kind ("TraitItemFunc");
+    hash_attrs (item.get_outer_attrs ());
+    TraitFunctionDecl &decl = item.get_decl ();
+    hash_qualifiers (decl.get_qualifiers ());
+    hash_ident (decl.get_function_name ());
+    visit_all (decl.get_generic_params ());
+    hash_self_param (decl.get_self ());
+    hash_function_params (decl.get_function_params ());
+    visit_opt (decl.get_return_type ());
+    visit_all (decl.get_where_clause ().get_items ());
+    visit_opt (item.get_block_expr ());
+  }
+
+  void visit (TraitItemConst &item) override
+  {
+    kind ("TraitItemConst");
+    hash_attrs (item.get_outer_attrs ());
+    hash_ident (item.get_name ());
+    visit_opt (item.get_type ());
+    visit_opt (item.get_expr ());
+  }
+
+  void visit (TraitItemType &item) override
+  {
+    kind ("TraitItemType");
+    hash_attrs (item.get_outer_attrs ());
+    hash_ident (item.get_name ());
+    visit_all (item.get_type_param_bounds ());
+  }
+
+  void visit (Trait &trait) override
+  {
+    kind ("Trait");
+    hash_vis_item (trait);
+    hasher.write_u8 (trait.is_unsafe ());
+    hash_ident (trait.get_name ());
+    visit_all (trait.get_generic_params ());
+    visit_all (trait.get_type_param_bounds ());
+    visit_all (trait.get_where_clause ().get_items ());
+    visit_all (trait.get_trait_items ());
+  }
+
+  void visit (ImplBlock &impl) override
+  {
+    kind ("ImplBlock");
+    hash_vis_item (impl);
+    hash_attrs (impl.get_inner_attrs ());
+    write_enum (impl.get_polarity ());
+    visit_all (impl.get_generic_params ());
+    visit_opt (impl.get_trait_ref ());
+    visit_opt (impl.get_type ());
+    visit_all (impl.get_where_clause ().get_items ());
+    visit_all (impl.get_impl_items ());
+  }
+
+  void visit (ExternalStaticItem &item) override
+  {
+    kind ("ExternalStaticItem");
+    hash_external_item (item);
+    hasher.write_u8 (item.is_mut ());
+    visit_opt (item.get_item_type ());
+  }
+
+  void visit (ExternalFunctionItem &item) override
+  {
+    kind ("ExternalFunctionItem");
+    hash_external_item (item);
+    visit_all (item.get_generic_params ());
+    hasher.write_u64 (item.get_function_params ().size ());
+    for (auto &param : item.get_function_params ())
+      {
+	hash_ident (param.get_param_name ());
+	visit_opt (param.get_type ());
+      }
+    hasher.write_u8 (item.is_variadic ());
+    visit_opt (item.get_return_type ());
+  }
+
+  void visit (ExternBlock &block) override
+  {
+    kind ("ExternBlock");
+    hash_vis_item (block);
+    hash_attrs (block.get_inner_attrs ());
+    write_enum (block.get_abi ());
+    visit_all (block.get_extern_items ());
+  }
+
+  void visit (LiteralPattern &pattern) override
+  {
+    kind ("LiteralPattern");
+    hash_literal (pattern.get_literal ());
+  }
+
+  void visit (IdentifierPattern &pattern) override
+  {
+    kind ("IdentifierPattern");
+    hash_ident (pattern.get_identifier ());
+    hasher.write_u8 (pattern.get_is_ref ());
+    hasher.write_u8 (pattern.is_mut ());
+    visit_opt (pattern.get_to_bind ());
+  }
+
+  void visit (WildcardPattern &) override { kind ("WildcardPattern"); }
+
+  void visit (RangePatternBoundLiteral &bound) override
+  {
+    kind ("RangePatternBoundLiteral");
+    hasher.write_u8 (bound.get_has_minus ());
+    hash_literal (bound.get_literal ());
+  }
+
+  void visit (RangePatternBoundPath &bound) override
+  {
+    kind ("RangePatternBoundPath");
+    bound.get_path ().accept_vis (*this);
+  }
+
+  void visit (RangePatternBoundQualPath &bound) override
+  {
+    kind ("RangePatternBoundQualPath");
+    bound.get_qualified_path ().accept_vis (*this);
+  }
+
+  void visit (RangePattern &pattern) override
+  {
+    kind ("RangePattern");
+    hasher.write_u8 (pattern.get_has_ellipsis_syntax ());
+    visit_opt (pattern.get_lower_bound ());
+    visit_opt (pattern.get_upper_bound ());
+  }
+
+  void visit (ReferencePattern &pattern) override
+  {
+    kind ("ReferencePattern");
+    hasher.write_u8 (pattern.is_mut ());
+    visit_opt (pattern.get_referenced_pattern ());
+  }
+
+  void visit (StructPatternFieldTuplePat &field) override
+  {
+    kind ("StructPatternFieldTuplePat");
+    hash_attrs (field.get_outer_attrs ());
+    hasher.write_u64 (field.get_index ());
+    visit_opt (field.get_tuple_pattern ());
+  }
+
+  void visit (StructPatternFieldIdentPat &field) override
+  {
+    kind ("StructPatternFieldIdentPat");
+    hash_attrs (field.get_outer_attrs ());
+    hash_ident (field.get_identifier ());
+    visit_opt (field.get_pattern ());
+  }
+
+  void visit (StructPatternFieldIdent &field) override
+  {
+    kind ("StructPatternFieldIdent");
+    hash_attrs (field.get_outer_attrs ());
+    hasher.write_u8 (field.get_has_ref ());
+    hasher.write_u8 (field.is_mut ());
+    hash_ident (field.get_identifier ());
+  }
+
+  void visit (StructPattern &pattern) override
+  {
+    kind ("StructPattern");
+    pattern.get_path ().accept_vis (*this);
+    StructPatternElements &elems = pattern.get_struct_pattern_elems ();
+    visit_all (elems.get_struct_pattern_fields ());
+  }
+
+  void visit (TupleStructItemsNoRange &tuple_items) override
+  {
+    kind ("TupleStructItemsNoRange");
+    visit_all (tuple_items.get_patterns ());
+  }
+
+  void visit (TupleStructItemsRange &tuple_items) override
+  {
+    kind ("TupleStructItemsRange");
+    visit_all (tuple_items.get_lower_patterns ());
+    visit_all (tuple_items.get_upper_patterns ());
+  }
+
+  void visit (TupleStructPattern &pattern) override
+  {
+    kind ("TupleStructPattern");
+    pattern.get_path ().accept_vis (*this);
+    visit_opt (pattern.get_items ());
+  }
+
+  void visit (TuplePatternItemsMultiple &tuple_items) override
+  {
+    kind ("TuplePatternItemsMultiple");
+    visit_all (tuple_items.get_patterns ());
+  }
+
+  void visit (TuplePatternItemsRanged &tuple_items) override
+  {
+    kind ("TuplePatternItemsRanged");
+    visit_all (tuple_items.get_lower_patterns ());
+    visit_all (tuple_items.get_upper_patterns ());
+  }
+
+  void visit (TuplePattern &pattern) override
+  {
+    kind ("TuplePattern");
+    visit_opt (pattern.get_items ());
+  }
+
+  void visit (SlicePattern &pattern) override
+  {
+    kind ("SlicePattern");
+    visit_all (pattern.get_items ());
+  }
+
+  void visit (AltPattern &pattern) override
+  {
+    kind ("AltPattern");
+    visit_all (pattern.get_alts ());
+  }
+
+  void visit (EmptyStmt &) override { kind ("EmptyStmt"); }
+
+  void visit (LetStmt &stmt) override
+  {
+    kind ("LetStmt");
+    hash_attrs (stmt.get_outer_attrs ());
+    visit_opt (stmt.get_pattern ());
+    visit_opt (stmt.get_type ());
+    visit_opt (stmt.get_init_expr ());
+  }
+
+  void visit (ExprStmt &stmt) override
+  {
+    kind ("ExprStmt");
+    hasher.write_u8 (stmt.is_unit_check_needed ());
+    visit_opt (stmt.get_expr ());
+  }
+
+  void visit (TraitBound &bound) override
+  {
+    kind ("TraitBound");
+    hasher.write_u8 (bound.get_in_parens ());
+    write_enum (bound.get_polarity ());
+    visit_all (bound.get_for_lifetimes ());
+    bound.get_path ().accept_vis (*this);
+  }
+
+  void visit (ImplTraitType &type) override
+  {
+    kind ("ImplTraitType");
+    visit_all (type.get_type_param_bounds ());
+  }
+
+  void visit (TraitObjectType &type) override
+  {
+    kind ("TraitObjectType");
+    hasher.write_u8 (type.get_has_dyn ());
+    visit_all (type.get_type_param_bounds ());
+  }
+
+  void visit (ParenthesisedType &type) override
+  {
+    kind ("ParenthesisedType");
+    visit_opt (type.get_type_in_parens ());
+  }
+
+  void visit (ImplTraitTypeOneBound &type) override
+  {
+    kind ("ImplTraitTypeOneBound");
+    type.get_trait_bound ().accept_vis (*this);
+  }
+
+  void visit (TupleType &type) override
+  {
+    kind ("TupleType");
+    visit_all (type.get_elems ());
+  }
+
+  void visit (NeverType &) override { kind ("NeverType"); }
+
+  void visit (RawPointerType &type) override
+  {
+    kind ("RawPointerType");
+    write_enum (type.get_mut ());
+    visit_opt (type.get_type ());
+  }
+
+  void visit (ReferenceType &type) override
+  {
+    kind ("ReferenceType");
+    hasher.write_u8 (type.has_lifetime ());
+    if (type.has_lifetime ())
+      type.get_lifetime ().accept_vis (*this);
+    write_enum (type.get_mut ());
+    visit_opt (type.get_base_type ());
+  }
+
+  void visit (ArrayType &type) override
+  {
+    kind ("ArrayType");
+    visit_opt (type.get_element_type ());
+    visit_opt (type.get_size_expr ());
+  }
+
+  void visit (SliceType &type) override
+  {
+    kind ("SliceType");
+    visit_opt (type.get_element_type ());
+  }
+
+  void visit (InferredType &) override { kind ("InferredType"); }
+
+  void visit (BareFunctionType &type) override
+  {
+    kind ("BareFunctionType");
+    visit_all (type.get_for_lifetimes ());
+    hash_qualifiers (type.get_function_qualifiers ());
+    hasher.write_u64 (type.get_function_params ().size ());
+    for (auto &param : type.get_function_params ())
+      {
+	write_enum (param.get_param_kind ());
+	hash_ident (param.get_name ());
+	visit_opt (param.get_type ());
+      }
+    hasher.write_u8 (type.get_is_variadic ());
+    visit_opt (type.get_return_type ());
+  }
+
+private:
+  void kind (const char *name) { hasher.write_str (name); }
+
+  template <typename E> void write_enum (E value)
+  {
+    hasher.write_u8 (static_cast<uint8_t> (value));
+  }
+
+  void hash_ident (const Identifier &ident)
+  {
+    hasher.write_str (ident.as_string ());
+  }
+
+  template <typename T> void visit_opt (std::unique_ptr<T> &node)
+  {
+    hasher.write_u8 (node != nullptr);
+    if (node)
+      node->accept_vis (*this);
+  }
+
+  template <typename T> void visit_all (std::vector<std::unique_ptr<T>> &nodes)
+  {
+    hasher.write_u64 (nodes.size ());
+    for (auto &node : nodes)
+      node->accept_vis (*this);
+  }
+
+  template <typename T> void visit_all (std::vector<T> &nodes)
+  {
+    hasher.write_u64 (nodes.size ());
+    for (auto &node : nodes)
+      node.accept_vis (*this);
+  }
+
+  void hash_attr (const AST::Attribute &attr)
+  {
+    hasher.write_str (attr.is_empty () ? "" : attr.as_string ());
+  }
+
+  void hash_attrs (const AST::AttrVec &attrs)
+  {
+    hasher.write_u64 (attrs.size ());
+    for (auto &attr : attrs)
+      hash_attr (attr);
+  }
+
+  void hash_visibility (const Visibility &vis)
+  {
+    write_enum (vis.get_vis_type ());
+    if (vis.is_restricted ())
+      hasher.write_str (restriction_path (vis.get_path ()));
+  }
+
+  void hash_literal (const Literal &lit)
+  {
+    write_enum (lit.get_lit_type ());
+    write_enum (lit.get_type_hint ());
+    hasher.write_str (lit.as_string ());
+  }
+
+  void hash_expr (Expr &expr) { hash_attrs (expr.get_outer_attrs ()); }
+
+  void hash_item (Item &item) { hash_attrs (item.get_outer_attrs ()); }
+
+  void hash_vis_item (VisItem &item)
+  {
+    hash_item (item);
+    hash_visibility (item.get_visibility ());
+  }
+
+  void hash_external_item (ExternalItem &item)
+  {
+    hash_attrs (item.get_outer_attrs ());
+    hash_visibility (item.get_visibility ());
+    hash_ident (item.get_item_name ());
+  }
+
+  void hash_generic_args (GenericArgs &args)
+  {
+    visit_all (args.get_lifetime_args ());
+    visit_all (args.get_type_args ());
+    hasher.write_u64 (args.get_const_args ().size ());
+    for (auto &arg : args.get_const_args ())
+      visit_opt (arg.get_expression ());
+    hasher.write_u64 (args.get_binding_args ().size ());
+    for (auto &arg : args.get_binding_args ())
+      {
+	hash_ident (arg.get_identifier ());
+	visit_opt (arg.get_type ());
+      }
+  }
+
+  void hash_path_segment (PathExprSegment &segment)
+  {
+    hasher.write_str (segment.get_segment ().as_string ());
+    hasher.write_u8 (segment.has_generic_args ());
+    if (segment.has_generic_args ())
+      hash_generic_args (segment.get_generic_args ());
+  }
+
+  void hash_path_segments (PathPattern &path)
+  {
+    hasher.write_u64 (path.get_segments ().size ());
+    for (auto &segment : path.get_segments ())
+      hash_path_segment (segment);
+  }
+
+  void hash_type_path_segment (TypePathSegment &segment)
+  {
+    hasher.write_str (segment.get_ident_segment ().as_string ());
+  }
+
+  void hash_qualified_path_type (QualifiedPathType &path_type)
+  {
+    visit_opt (path_type.get_type ());
+    visit_opt (path_type.get_trait ());
+  }
+
+  void hash_qualifiers (const FunctionQualifiers &qualifiers)
+  {
+    write_enum (qualifiers.get_status ());
+    hasher.write_u8 (qualifiers.is_unsafe ());
+    write_enum (qualifiers.get_abi ());
+  }
+
+  void hash_self_param (SelfParam &self)
+  {
+    write_enum (self.get_self_kind ());
+    if (self.is_error ())
+      return;
+
+    hasher.write_u8 (self.has_lifetime ());
+    if (self.has_lifetime ())
+      self.get_lifetime ().accept_vis (*this);
+    visit_opt (self.get_type ());
+  }
+
+  void hash_function_params (std::vector<FunctionParam> &params)
+  {
+    hasher.write_u64 (params.size ());
+    for (auto &param : params)
+      {
+	visit_opt (param.get_param_name ());
+	visit_opt (param.get_type ());
+      }
+  }
+
+  void hash_struct_fields (std::vector<StructField> &fields)
+  {
+    hasher.write_u64 (fields.size ());
+    for (auto &field : fields)
+      {
+	hash_attrs (field.get_outer_attrs ());
+	hash_visibility (field.get_visibility ());
+	hash_ident (field.get_field_name ());
+	visit_opt (field.get_field_type ());
+      }
+  }
+
+  void hash_tuple_fields (std::vector<TupleField> &fields)
+  {
+    hasher.write_u64 (fields.size ());
+    for (auto &field : fields)
+      {
+	hash_attrs (field.get_outer_attrs ());
+	hash_visibility (field.get_visibility ());
+	visit_opt (field.get_field_type ());
+      }
+  }
+
+  void hash_struct (Struct &struct_item)
+  {
+    hash_vis_item (struct_item);
+    hash_ident (struct_item.get_identifier ());
+    visit_all (struct_item.get_generic_params ());
+    visit_all (struct_item.get_where_clause ().get_items ());
+  }
+
+  void hash_enum_item (EnumItem &item)
+  {
+    hash_item (item);
+    hash_ident (item.get_identifier ());
+  }
+
+  void hash_struct_expr (StructExprStruct &expr)
+  {
+    hash_expr (expr);
+    hash_attrs (expr.get_inner_attrs ());
+    expr.get_struct_name ().accept_vis (*this);
+  }
+
+  void hash_loop (BaseLoopExpr &expr)
+  {
+    hash_expr (expr);
+    hasher.write_u8 (expr.has_loop_label ());
+    if (expr.has_loop_label ())
+      expr.get_loop_label ().get_lifetime ().accept_vis (*this);
+    visit_opt (expr.get_loop_block ());
+  }
+
+  void hash_if (IfExpr &expr)
+  {
+    hash_expr (expr);
+    visit_opt (expr.get_if_condition ());
+    visit_opt (expr.get_if_block ());
+  }
+
+  void hash_if_let (IfLetExpr &expr)
+  {
+    hash_expr (expr);
+    visit_all (expr.get_patterns ());
+    visit_opt (expr.get_scrutinee_expr ());
+    visit_opt (expr.get_if_block ());
+  }
+
+  Hash::StableHasher &hasher;
+};
+
+Hash::Fingerprint
+Fingerprinter::node (FullVisitable &v)
+{
+  Hash::StableHasher hasher;
+  StructuralHasher structural (hasher);
+  v.accept_vis (structural);
+  return hasher.finish ();
+}
+
+Hash::Fingerprint
+Fingerprinter::type (const TyTy::BaseType *ty)
+{
+  Hash::StableHasher hasher;
+  hash_type (hasher, ty);
+  return hasher.finish ();
+}
+
+bool
+Fingerprinter::signature (const Analysis::NodeMapping &mappings,
+			  Hash::Fingerprint &fp)
+{
+  TyTy::BaseType *ty = nullptr;
+  if (!Resolver::TypeCheckContext::get ()->lookup_type (mappings.get_hirid (),
+							 &ty))
+    return false;
+
+  fp = type (ty);
+  return true;
+}
+
+void
+Fingerprinter::hash_type (Hash::StableHasher &hasher,
+			  const TyTy::BaseType *ty)
+{
+  // generic parameters, placeholders and projections hash as whatever they
+  // currently stand for
+  ty = ty->destructure ();
+  hasher.write_u8 (ty->get_kind ());
+
+  switch (ty->get_kind ())
+    {
+      case TyTy::ADT: {
+	auto adt = static_cast<const TyTy::ADTType *> (ty);
+	hasher.write_str (adt->get_ident ().path.get ());
+	hasher.write_u64 (adt->get_substs ().size ());
+	for (auto &mapping : adt->get_substs ())
+	  hash_type (hasher, mapping.get_param_ty ());
+      }
+      break;
+
+      case TyTy::REF: {
+	auto ref = static_cast<const TyTy::ReferenceType *> (ty);
+	hasher.write_u8 (ref->is_mutable ());
+	hash_type (hasher, ref->get_base ());
+      }
+      break;
+
+      case TyTy::POINTER: {
+	auto ptr = static_cast<const TyTy::PointerType *> (ty);
+	hasher.write_u8 (ptr->is_mutable ());
+	hash_type (hasher, ptr->get_base ());
+      }
+      break;
+
+      case TyTy::PARAM: {
+	auto param = static_cast<const TyTy::ParamType *> (ty);
+	hasher.write_str (param->get_symbol ());
+      }
+      break;
+
+      case TyTy::PLACEHOLDER: {
+	auto placeholder = static_cast<const TyTy::PlaceholderType *> (ty);
+	hasher.write_str (placeholder->get_symbol ());
+      }
+      break;
+
+      case TyTy::ARRAY: {
+	auto array = static_cast<const TyTy::ArrayType *> (ty);
+	hash_type (hasher, array->get_element_type ());
+	hasher.write_fingerprint (node (array->get_capacity_expr ()));
+      }
+      break;
+
+      case TyTy::SLICE: {
+	auto slice = static_cast<const TyTy::SliceType *> (ty);
+	hash_type (hasher, slice->get_element_type ());
+      }
+      break;
+
+      case TyTy::FNDEF: {
+	auto fn = static_cast<const TyTy::FnType *> (ty);
+	hasher.write_str (fn->get_ident ().path.get ());
+	hasher.write_u64 (fn->get_substs ().size ());
+	for (auto &mapping : fn->get_substs ())
+	  hash_type (hasher, mapping.get_param_ty ());
+	hasher.write_u64 (fn->get_params ().size ());
+	for (auto &param : fn->get_params ())
+	  hash_type (hasher, param.second);
+	hash_type (hasher, fn->get_return_type ());
+      }
+      break;
+
+      case TyTy::FNPTR: {
+	auto fn = static_cast<const TyTy::FnPtr *> (ty);
+	hasher.write_u64 (fn->get_params ().size ());
+	for (auto &param : fn->get_params ())
+	  hash_type (hasher, param.get_tyty ());
+	hash_type (hasher, fn->get_return_type ());
+      }
+      break;
+
+      case TyTy::TUPLE: {
+	auto tuple = static_cast<const TyTy::TupleType *> (ty);
+	hasher.write_u64 (tuple->num_fields ());
+	for (size_t i = 0; i < tuple->num_fields (); i++)
+	  hash_type (hasher, tuple->get_field (i));
+      }
+      break;
+
+      case TyTy::INT: {
+	auto i = static_cast<const TyTy::IntType *> (ty);
+	hasher.write_u8 (i->get_int_kind ());
+      }
+      break;
+
+      case TyTy::UINT: {
+	auto u = static_cast<const TyTy::UintType *> (ty);
+	hasher.write_u8 (u->get_uint_kind ());
+      }
+      break;
+
+      case TyTy::FLOAT: {
+	auto f = static_cast<const TyTy::FloatType *> (ty);
+	hasher.write_u8 (f->get_float_kind ());
+      }
+      break;
+
+      case TyTy::DYNAMIC: {
+	auto dyn = static_cast<const TyTy::DynamicObjectType *> (ty);
+	hasher.write_u64 (dyn->get_specified_bounds ().size ());
+	for (auto &bound : dyn->get_specified_bounds ())
+	  hasher.write_str (bound.get_name ());
+      }
+      break;
+
+      case TyTy::CLOSURE: {
+	auto closure = static_cast<const TyTy::ClosureType *> (ty);
+	hash_type (hasher, &closure->get_parameters ());
+	hash_type (hasher, &closure->get_result_type ());
+      }
+      break;
+
+      case TyTy::INFER: {
+	auto infer = static_cast<const TyTy::InferType *> (ty);
+	hasher.write_u8 (infer->get_infer_kind ());
+      }
+      break;
+
+    case TyTy::STR:
+    case TyTy::BOOL:
+    case TyTy::CHAR:
+    case TyTy::USIZE:
+    case TyTy::ISIZE:
+    case TyTy::NEVER:
+    case TyTy::PROJECTION:
+    case TyTy::ERROR:
+      break;
+    }
+}
+
+static std::string
+item_kind_string (Item::ItemKind kind)
+{
+  switch (kind)
+    {
+    case Item::ItemKind::Static:
+      return "static";
+    case Item::ItemKind::Constant:
+      return "const";
+    case Item::ItemKind::TypeAlias:
+      return "type";
+    case Item::ItemKind::Function:
+      return "fn";
+    case Item::ItemKind::UseDeclaration:
+      return "use";
+    case Item::ItemKind::ExternBlock:
+      return "extern";
+    case Item::ItemKind::ExternCrate:
+      return "extern crate";
+    case Item::ItemKind::Struct:
+      return "struct";
+    case Item::ItemKind::Union:
+      return "union";
+    case Item::ItemKind::Enum:
+      return "enum";
+    case Item::ItemKind::EnumItem:
+      return "variant";
+    case Item::ItemKind::Trait:
+      return "trait";
+    case Item::ItemKind::Impl:
+      return "impl";
+    case Item::ItemKind::Module:
+      return "mod";
+    }
+  rust_unreachable ();
+}
+
+static void
+dump_line (std::ostream &out, FullVisitable &v,
+	   const Analysis::NodeMapping &mappings, const std::string &path)
+{
+  Hash::Fingerprint sig;
+  out << Fingerprinter::node (v).as_string () << " "
+      << (Fingerprinter::signature (mappings, sig) ? sig.as_string ()
+						    : std::string (32, '-'))
+      << " " << path << "\n";
+}
+
+static void
+dump_items (std::ostream &out, std::vector<std::unique_ptr<Item>> &items,
+	    const std::string &parent)
+{
+  auto mappings = Analysis::Mappings::get ();
+
+  // items without a path of their own, such as impl blocks, are named after
+  // their kind and their rank among the items of that kind in their parent
+  std::map<Item::ItemKind, size_t> unnamed;
+
+  for (auto &item : items)
+    {
+      const Resolver::CanonicalPath *canonical = nullptr;
+      std::string path;
+      if (mappings->lookup_canonical_path (item->get_mappings ().get_nodeid (),
+					   &canonical))
+	path = canonical->get ();
+      else
+	path = parent + "::{" + item_kind_string (item->get_item_kind ()) + "#"
+	       + std::to_string (unnamed[item->get_item_kind ()]++) + "}";
+
+      dump_line (out, *item, item->get_mappings (), path);
+
+      if (item->get_item_kind () == Item::ItemKind::Module)
+	{
+	  auto &module = static_cast<Module &> (*item);
+	  dump_items (out, module.get_items (), path);
+	}
+      else if (item->get_item_kind () == Item::ItemKind::Impl)
+	{
+	  auto &impl = static_cast<ImplBlock &> (*item);
+	  for (auto &impl_item : impl.get_impl_items ())
+	    {
+	      const Analysis::NodeMapping &impl_mappings
+		= impl_item->get_impl_mappings ();
+	      std::string item_path
+		= path + "::" + impl_item->get_impl_item_name ();
+	      if (mappings->lookup_canonical_path (impl_mappings.get_nodeid (),
+						   &canonical))
+		item_path = canonical->get ();
+
+	      dump_line (out, *impl_item, impl_mappings, item_path);
+	    }
+	}
+    }
+}
+
+void
+Fingerprinter::dump (Crate &crate, std::ostream &out)
+{
+  dump_items (out, crate.get_items (),
+	      Analysis::Mappings::get ()->get_current_crate_name ());
+}
+
+} // namespace HIR
+} // namespace Rust
+
+#if CHECKING_P
+
+namespace selftest {
+
+/* Builds `pub const N: i32 = a + VALUE;`, numbering its nodes from FIRST. */
+static std::unique_ptr<Rust::HIR::Item>
+make_constant (uint32_t first, const std::string &value)
+{
+  using namespace Rust;
+  using namespace Rust::HIR;
+
+  uint32_t id = first;
+  auto next = [&] () {
+    id++;
+    return Analysis::NodeMapping (0, id, id, id);
+  };
+
+  std::vector<std::unique_ptr<TypePathSegment>> type_segments;
+  type_segments.push_back (
+    Rust::make_unique<TypePathSegment> (next (), "i32", false,
+					UNDEF_LOCATION));
+  auto type = Rust::make_unique<TypePath> (next (), std::move (type_segments),
+					   UNDEF_LOCATION);
+
+  std::vector<PathExprSegment> segments;
+  segments.push_back (PathExprSegment (next (), PathIdentSegment ("a"),
+				       UNDEF_LOCATION,
+				       GenericArgs::create_empty ()));
+  auto lhs
+    = Rust::make_unique<PathInExpression> (next (), std::move (segments));
+  auto rhs = Rust::make_unique<LiteralExpr> (next (), value, Literal::INT,
+					     PrimitiveCoreType::CORETYPE_I32,
+					     UNDEF_LOCATION, AST::AttrVec ());
+  auto expr = Rust::make_unique<ArithmeticOrLogicalExpr> (
+    next (), std::move (lhs), std::move (rhs), ArithmeticOrLogicalOperator::ADD,
+    UNDEF_LOCATION);
+
+  return Rust::make_unique<ConstantItem> (next (), Identifier ("N"),
+					  Visibility (Visibility::PUBLIC),
+					  std::move (type), std::move (expr),
+					  AST::AttrVec (), UNDEF_LOCATION);
+}
+
+void
+rust_hir_fingerprint_test (void)
+{
+  using namespace Rust;
+  using HIR::Fingerprinter;
+
+  auto item = make_constant (10, "1");
+  auto renumbered = make_constant (5000, "1");
+  auto changed = make_constant (10, "2");
+
+  Hash::Fingerprint fp = Fingerprinter::node (*item);
+
+  // only the numbering differs, so the fingerprint must not
+  ASSERT_TRUE (fp == Fingerprinter::node (*renumbered));
+  ASSERT_TRUE (fp != Fingerprinter::node (*changed));
+}
+
+} // namespace selftest
+
+#endif // CHECKING_P
@@ -0,0 +1,70 @@
+// Copyright (C) 2020-2023 Free Software Foundation, Inc.
+
+// This file is part of GCC.
+
+// GCC is free software; you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3, or (at your option) any later
+// version.
+
+// GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+// for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with GCC; see the file COPYING3.  If not see
+// <http://www.gnu.org/licenses/>.
+#ifndef RUST_HIR_FINGERPRINT_H
+#define RUST_HIR_FINGERPRINT_H
+
+#include "rust-stable-hash.h"
+#include "rust-hir-full.h"
+#include "rust-tyty.h"
+
+namespace Rust {
+namespace HIR {
+
+/**
+ * Computes stable fingerprints of HIR nodes and of their types. These only
+ * depend on the source-level structure and names involved: NodeIds, HirIds,
+ * locations and allocation addresses are all left out, so an item keeps its
+ * fingerprint across compilations unless it actually changed.
+ */
+class Fingerprinter
+{
+public:
+  /* The structure of a node and everything below it, e.g. the whole body of
+   * a function: the kind, names, literals and flags of each node, with the
+   * paths named by `pub(in path)` resolved to their canonical paths. */
+  static Hash::Fingerprint node (FullVisitable &v);
+
+  /* A type, identified by its kind, the canonical paths of any items it names
+   * and its generic arguments. */
+  static Hash::Fingerprint type (const TyTy::BaseType *ty);
+
+  /* The signature of the item with the given mappings, i.e. the fingerprint
+   * of the type the type checker gave it. Returns false if it has none, as
+   * for modules or use declarations. */
+  static bool signature (const Analysis::NodeMapping &mappings,
+			 Hash::Fingerprint &fp);
+
+  /* Writes one line per item of the crate, nested items included, holding
+   * the node and signature fingerprints and the item path. */
+  static void dump (Crate &crate, std::ostream &out);
+
+private:
+  static void hash_type (Hash::StableHasher &hasher, const TyTy::BaseType *ty);
+};
+
+} // namespace HIR
+} // namespace Rust
+
+#if CHECKING_P
+namespace selftest {
+void
+rust_hir_fingerprint_test (void);
+}
+#endif // !CHECKING_P
+
+#endif // RUST_HIR_FINGERPRINT_H
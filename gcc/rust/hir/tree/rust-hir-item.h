@@ -454,6 +454,8 @@ public:
 
   std::unique_ptr<Type> &get_type () { return type; }
 
+  Lifetime &get_lifetime () { return lifetime; }
+
   Analysis::NodeMapping get_mappings () { return mappings; }
 
   Mutability get_mut () const
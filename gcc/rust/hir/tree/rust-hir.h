@@ -659,6 +659,10 @@ class LifetimeParam : public GenericParam
 public:
   Lifetime get_lifetime () { return lifetime; }
 
+  std::vector<Lifetime> &get_lifetime_bounds () { return lifetime_bounds; }
+
+  AST::Attribute &get_outer_attribute () { return outer_attr; }
+
   // Returns whether the lifetime param has any lifetime bounds.
   bool has_lifetime_bounds () const { return !lifetime_bounds.empty (); }
 
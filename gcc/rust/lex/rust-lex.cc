@@ -1227,12 +1227,12 @@ Lexer::parse_in_type_suffix ()
     }
 }
 
-// Parses in the exponent part (if any) of a float literal.
-std::pair<std::string, int>
-Lexer::parse_in_exponent_part ()
+/* Parses in the exponent part (if any) of a float literal, appending it to
+ * STR. Returns the number of characters consumed. */
+int
+Lexer::parse_in_exponent_part (std::string &str)
 {
   int additional_length_offset = 0;
-  std::string str;
   if (current_char == 'E' || current_char == 'e')
     {
       // add exponent to string as strtod works with it
@@ -1262,21 +1262,21 @@ Lexer::parse_in_exponent_part ()
 	}
 
       // parse another decimal number for exponent
-      auto str_length = parse_in_decimal ();
-      str += std::get<0> (str_length);
-      additional_length_offset += std::get<1> (str_length);
+      additional_length_offset += parse_in_decimal (str).first;
     }
-  return std::make_pair (str, additional_length_offset);
+  return additional_length_offset;
 }
 
-// Parses a decimal integer.
-std::tuple<std::string, int, bool>
-Lexer::parse_in_decimal ()
+/* Parses a decimal integer, appending its digits to STR so that literals are
+ * built in place rather than through temporaries. Returns the number of
+ * characters consumed and whether the integer was pure, i.e. without any
+ * underscore. */
+std::pair<int, bool>
+Lexer::parse_in_decimal (std::string &str)
 {
   /* A pure decimal contains only digits.  */
   bool pure_decimal = true;
   int additional_length_offset = 0;
-  std::string str;
   while (ISDIGIT (current_char.value) || current_char.value == '_')
     {
       if (current_char == '_')
@@ -1297,7 +1297,7 @@ Lexer::parse_in_decimal ()
       skip_input ();
       current_char = peek_input ();
     }
-  return std::make_tuple (str, additional_length_offset, pure_decimal);
+  return std::make_pair (additional_length_offset, pure_decimal);
 }
 
 /* Parses escapes (and string continues) in "byte" strings and characters. Does
@@ -2014,7 +2014,7 @@ Lexer::parse_string (location_t loc)
 	    length += std::get<1> (utf8_escape_pair);
 
 	  if (current_char != Codepoint (0) || !std::get<2> (utf8_escape_pair))
-	    str += current_char.as_string ();
+	    str += current_char;
 
 	  // FIXME: should remove this but can't.
 	  // `parse_utf8_escape` does not update `current_char` correctly.
@@ -2158,7 +2158,7 @@ Lexer::parse_raw_string (location_t loc, int initial_hash_count)
 
       length++;
 
-      str += current_char.as_string ();
+      str += current_char;
       skip_input ();
       current_char = peek_input ();
     }
@@ -2283,9 +2283,8 @@ Lexer::parse_decimal_int_or_float (location_t loc)
   current_char = peek_input ();
 
   // parse initial decimal integer (or first integer part of float) literal
-  auto initial_decimal = parse_in_decimal ();
-  str += std::get<0> (initial_decimal);
-  length += std::get<1> (initial_decimal);
+  auto initial_decimal = parse_in_decimal (str);
+  length += initial_decimal.first;
 
   // detect float literal
   //
@@ -2309,14 +2308,10 @@ Lexer::parse_decimal_int_or_float (location_t loc)
       length++;
 
       // parse another decimal number for float
-      auto second_decimal = parse_in_decimal ();
-      str += std::get<0> (second_decimal);
-      length += std::get<1> (second_decimal);
+      length += parse_in_decimal (str).first;
 
       // parse in exponent part if it exists
-      auto exponent_pair = parse_in_exponent_part ();
-      str += exponent_pair.first;
-      length += exponent_pair.second;
+      length += parse_in_exponent_part (str);
 
       // parse in type suffix if it exists
       auto type_suffix_pair = parse_in_type_suffix ();
@@ -2365,9 +2360,7 @@ Lexer::parse_decimal_int_or_float (location_t loc)
       // exponent float with no '.' character
 
       // parse exponent part
-      auto exponent_pair = parse_in_exponent_part ();
-      str += exponent_pair.first;
-      length += exponent_pair.second;
+      length += parse_in_exponent_part (str);
 
       // parse in type suffix if it exists
       auto type_suffix_pair = parse_in_type_suffix ();
@@ -2401,7 +2394,7 @@ Lexer::parse_decimal_int_or_float (location_t loc)
       /* A "real" pure decimal doesn't have a suffix and no zero prefix.  */
       if (type_hint == CORETYPE_UNKNOWN)
 	{
-	  bool pure_decimal = std::get<2> (initial_decimal);
+	  bool pure_decimal = initial_decimal.second;
 	  if (pure_decimal && (!first_zero || str.size () == 1))
 	    type_hint = CORETYPE_PURE_DECIMAL;
 	}
@@ -128,8 +128,8 @@ private:
   // Classifies keyword (i.e. gets id for keyword).
   TokenId classify_keyword (const std::string &str);
 
-  std::tuple<std::string, int, bool> parse_in_decimal ();
-  std::pair<std::string, int> parse_in_exponent_part ();
+  std::pair<int, bool> parse_in_decimal (std::string &str);
+  int parse_in_exponent_part (std::string &str);
   std::pair<PrimitiveCoreType, int> parse_in_type_suffix ();
   std::tuple<char, int, bool> parse_escape (char opening_char);
   std::tuple<Codepoint, int, bool> parse_utf8_escape ();
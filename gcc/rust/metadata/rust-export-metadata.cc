@@ -28,11 +28,42 @@
 #include "md5.h"
 #include "rust-system.h"
 
+#ifdef HAVE_ZSTD_H
+#include <zstd.h>
+#endif
+
 namespace Rust {
 namespace Metadata {
 
 static const std::string extension_path = ".rox";
 
+#ifdef HAVE_ZSTD_H
+static const int kZstdLevel = 3;
+#endif
+
+// Returns the interface BUF as it is to be stored in the metadata and sets
+// *MAGIC to the header announcing that encoding. The textual interface of a
+// large crate compresses very well, so it is zstd-compressed whenever the
+// compiler was built with zstd.
+static std::string
+encode_interface (const std::string &buf, const char **magic)
+{
+#ifdef HAVE_ZSTD_H
+  std::string out (ZSTD_compressBound (buf.size ()), '\0');
+  size_t size = ZSTD_compress (&out[0], out.size (), buf.data (), buf.size (),
+			       kZstdLevel);
+  if (!ZSTD_isError (size))
+    {
+      out.resize (size);
+      *magic = kMagicHeaderZstd;
+      return out;
+    }
+#endif
+
+  *magic = kMagicHeader;
+  return buf;
+}
+
 ExportContext::ExportContext () : mappings (Analysis::Mappings::get ()) {}
 
 ExportContext::~ExportContext () {}
@@ -246,7 +277,6 @@ PublicInterface::write_to_object_file () const
 {
   // done
   const auto &buf = context.get_interface_buffer ();
-  std::string size_buffer = std::to_string (buf.size ());
 
   // md5 this
   struct md5_ctx chksm;
@@ -256,11 +286,15 @@ PublicInterface::write_to_object_file () const
   md5_process_bytes (buf.c_str (), buf.size (), &chksm);
   md5_finish_ctx (&chksm, checksum);
 
+  const char *magic;
+  const std::string contents = encode_interface (buf, &magic);
+  std::string size_buffer = std::to_string (contents.size ());
+
   // MAGIC MD5 DLIM  DLIM buffer-size DELIM contents
   const std::string current_crate_name = mappings.get_current_crate_name ();
 
   // extern void
-  rust_write_export_data (kMagicHeader, sizeof (kMagicHeader));
+  rust_write_export_data (magic, sizeof (kMagicHeader));
   rust_write_export_data ((const char *) checksum, sizeof (checksum));
   rust_write_export_data (kSzDelim, sizeof (kSzDelim));
   rust_write_export_data (current_crate_name.c_str (),
@@ -268,7 +302,7 @@ PublicInterface::write_to_object_file () const
   rust_write_export_data (kSzDelim, sizeof (kSzDelim));
   rust_write_export_data (size_buffer.c_str (), size_buffer.size ());
   rust_write_export_data (kSzDelim, sizeof (kSzDelim));
-  rust_write_export_data (buf.c_str (), buf.size ());
+  rust_write_export_data (contents.c_str (), contents.size ());
 }
 
 void
@@ -288,7 +322,6 @@ PublicInterface::write_to_path (const std::string &path) const
 
   // done
   const auto &buf = context.get_interface_buffer ();
-  std::string size_buffer = std::to_string (buf.size ());
 
   // md5 this
   struct md5_ctx chksm;
@@ -298,6 +331,10 @@ PublicInterface::write_to_path (const std::string &path) const
   md5_process_bytes (buf.c_str (), buf.size (), &chksm);
   md5_finish_ctx (&chksm, checksum);
 
+  const char *magic;
+  const std::string contents = encode_interface (buf, &magic);
+  std::string size_buffer = std::to_string (contents.size ());
+
   // MAGIC MD5 DLIM  DLIM buffer-size DELIM contents
   const std::string current_crate_name = mappings.get_current_crate_name ();
 
@@ -312,7 +349,7 @@ PublicInterface::write_to_path (const std::string &path) const
     }
 
   // write data
-  if (fwrite (kMagicHeader, sizeof (kMagicHeader), 1, nfd) < 1)
+  if (fwrite (magic, sizeof (kMagicHeader), 1, nfd) < 1)
     {
       rust_error_at (UNDEF_LOCATION, "failed to write to file %<%s%>: %s",
 		     path.c_str (), xstrerror (errno));
@@ -369,8 +406,8 @@ PublicInterface::write_to_path (const std::string &path) const
       return;
     }
 
-  if (!buf.empty ())
-    if (fwrite (buf.c_str (), buf.size (), 1, nfd) < 1)
+  if (!contents.empty ())
+    if (fwrite (contents.c_str (), contents.size (), 1, nfd) < 1)
       {
 	rust_error_at (UNDEF_LOCATION, "failed to write to file %<%s%>: %s",
 		       path.c_str (), xstrerror (errno));
@@ -27,6 +27,8 @@ namespace Rust {
 namespace Metadata {
 
 static const char kMagicHeader[4] = {'G', 'R', 'S', 'T'};
+// Same as kMagicHeader, for metadata whose contents are zstd-compressed
+static const char kMagicHeaderZstd[4] = {'G', 'R', 'S', 'Z'};
 static const char kSzDelim[1] = {'$'};
 
 class ExportContext
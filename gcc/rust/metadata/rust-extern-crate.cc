@@ -22,9 +22,43 @@
 
 #include "md5.h"
 
+#ifdef HAVE_ZSTD_H
+#include <zstd.h>
+#endif
+
 namespace Rust {
 namespace Imports {
 
+// Replaces BUF, a zstd frame holding the interface of a crate, with the
+// interface itself.
+static bool
+decompress_interface (location_t locus, std::string &buf)
+{
+#ifdef HAVE_ZSTD_H
+  unsigned long long size = ZSTD_getFrameContentSize (buf.data (), buf.size ());
+  if (size == ZSTD_CONTENTSIZE_ERROR || size == ZSTD_CONTENTSIZE_UNKNOWN)
+    {
+      rust_error_at (locus, "corrupt compressed crate metadata");
+      return false;
+    }
+
+  std::string out (size, '\0');
+  size_t got = ZSTD_decompress (&out[0], size, buf.data (), buf.size ());
+  if (ZSTD_isError (got) || got != size)
+    {
+      rust_error_at (locus, "corrupt compressed crate metadata");
+      return false;
+    }
+
+  buf = std::move (out);
+  return true;
+#else
+  rust_error_at (locus, "crate metadata is zstd-compressed but this compiler "
+			"was built without zstd support");
+  return false;
+#endif
+}
+
 ExternCrate::ExternCrate (Import::Stream &stream) : import_stream (stream) {}
 
 ExternCrate::ExternCrate (const std::string &crate_name,
@@ -45,9 +79,15 @@ ExternCrate::load (location_t locus)
 {
   rust_assert (this->import_stream.has_value ());
   auto &import_stream = this->import_stream->get ();
-  // match header
-  import_stream.require_bytes (locus, Metadata::kMagicHeader,
-			       sizeof (Metadata::kMagicHeader));
+  // match header, which also tells whether the contents are compressed
+  bool compressed
+    = import_stream.match_bytes (Metadata::kMagicHeaderZstd,
+				 sizeof (Metadata::kMagicHeaderZstd));
+  if (compressed)
+    import_stream.advance (sizeof (Metadata::kMagicHeaderZstd));
+  else
+    import_stream.require_bytes (locus, Metadata::kMagicHeader,
+				 sizeof (Metadata::kMagicHeader));
   if (import_stream.saw_error ())
     return false;
 
@@ -115,13 +155,19 @@ ExternCrate::load (location_t locus)
     return false;
 
   // read the parsed size and it should be eof
-  metadata_buffer.reserve (expected_buffer_length);
-  for (int i = 0; i < expected_buffer_length && !import_stream.saw_error ()
-		  && !import_stream.at_eof ();
-       i++)
+  const char *contents;
+  if (!import_stream.peek (expected_buffer_length, &contents))
     {
-      metadata_buffer += import_stream.get_char ();
+      import_stream.set_saw_error ();
+      rust_error_at (locus, "failed to read metadata contents");
+
+      return false;
     }
+  metadata_buffer.assign (contents, expected_buffer_length);
+  import_stream.advance (expected_buffer_length);
+
+  if (compressed && !decompress_interface (locus, metadata_buffer))
+    return false;
 
   // compute the md5
   struct md5_ctx chksm;
@@ -258,7 +258,10 @@ Import::find_export_data (const std::string &filename, int fd,
   // FIXME we need to work out a better header
   //
   if (memcmp (buf, Metadata::kMagicHeader, sizeof (Metadata::kMagicHeader))
-      == 0)
+	== 0
+      || memcmp (buf, Metadata::kMagicHeaderZstd,
+		 sizeof (Metadata::kMagicHeaderZstd))
+	   == 0)
     return Rust::make_unique<Stream_from_file> (fd);
 
   // See if we can read this as an archive.
@@ -376,51 +379,79 @@ Import::Stream::require_bytes (location_t location, const char *bytes,
 
 // Class Stream_from_file.
 
-Stream_from_file::Stream_from_file (int fd) : fd_ (fd), data_ ()
+// The whole file is made available at once: mapped into memory where
+// possible, read into a buffer otherwise.  Peeking and advancing are then
+// plain pointer arithmetic rather than a read and two lseeks per call.
+
+Stream_from_file::Stream_from_file (int fd)
+  : fd_ (fd), map_ (nullptr), data_ (), bytes_ (nullptr), length_ (0),
+    pos_ (0)
 {
-  if (lseek (fd, 0, SEEK_SET) != 0)
+  struct stat st;
+  if (fstat (fd, &st) != 0)
     {
-      rust_fatal_error (UNKNOWN_LOCATION, "lseek failed: %m");
+      rust_fatal_error (UNKNOWN_LOCATION, "fstat failed: %m");
       this->set_saw_error ();
+      return;
     }
-}
+  this->length_ = st.st_size;
 
-Stream_from_file::~Stream_from_file () { close (this->fd_); }
-
-// Read next bytes.
-
-bool
-Stream_from_file::do_peek (size_t length, const char **bytes)
-{
-  if (this->data_.length () >= length)
+#ifdef HAVE_MMAP_FILE
+  if (this->length_ > 0)
     {
-      *bytes = this->data_.data ();
-      return true;
+      void *map = mmap (NULL, this->length_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map != MAP_FAILED)
+	{
+	  this->map_ = static_cast<char *> (map);
+	  this->bytes_ = this->map_;
+	  return;
+	}
     }
+#endif
 
-  this->data_.resize (length);
-  ssize_t got = ::read (this->fd_, &this->data_[0], length);
-
-  if (got < 0)
+  if (lseek (fd, 0, SEEK_SET) != 0)
     {
-      if (!this->saw_error ())
-	rust_fatal_error (UNKNOWN_LOCATION, "read failed: %m");
+      rust_fatal_error (UNKNOWN_LOCATION, "lseek failed: %m");
       this->set_saw_error ();
-      return false;
+      return;
     }
 
-  if (lseek (this->fd_, -got, SEEK_CUR) < 0)
+  this->data_.resize (this->length_);
+  size_t have = 0;
+  while (have < this->length_)
     {
-      if (!this->saw_error ())
-	rust_fatal_error (UNKNOWN_LOCATION, "lseek failed: %m");
-      this->set_saw_error ();
-      return false;
+      ssize_t got = ::read (fd, &this->data_[have], this->length_ - have);
+      if (got < 0)
+	{
+	  rust_fatal_error (UNKNOWN_LOCATION, "read failed: %m");
+	  this->set_saw_error ();
+	  return;
+	}
+      if (got == 0)
+	break;
+      have += got;
     }
+  this->length_ = have;
+  this->bytes_ = this->data_.data ();
+}
 
-  if (static_cast<size_t> (got) < length)
-    return false;
+Stream_from_file::~Stream_from_file ()
+{
+#ifdef HAVE_MMAP_FILE
+  if (this->map_ != nullptr)
+    munmap (this->map_, this->length_);
+#endif
+  close (this->fd_);
+}
 
-  *bytes = this->data_.data ();
+// Read next bytes.
+
+bool
+Stream_from_file::do_peek (size_t length, const char **bytes)
+{
+  if (this->pos_ + length > this->length_)
+    return false;
+  *bytes = this->bytes_ + this->pos_;
   return true;
 }
 
@@ -429,19 +460,7 @@ Stream_from_file::do_peek (size_t length, const char **bytes)
 void
 Stream_from_file::do_advance (size_t skip)
 {
-  if (lseek (this->fd_, skip, SEEK_CUR) < 0)
-    {
-      if (!this->saw_error ())
-	rust_fatal_error (UNKNOWN_LOCATION, "lseek failed: %m");
-      this->set_saw_error ();
-    }
-  if (!this->data_.empty ())
-    {
-      if (this->data_.length () > skip)
-	this->data_.erase (0, skip);
-      else
-	this->data_.clear ();
-    }
+  this->pos_ += skip;
 }
 
 } // namespace Rust
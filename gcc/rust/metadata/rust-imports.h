@@ -252,8 +252,16 @@ private:
 
   // The file descriptor.
   int fd_;
-  // Data read from the file.
+  // The file mapped into memory, or NULL if it could not be mapped.
+  char *map_;
+  // The file contents, if it could not be mapped.
   std::string data_;
+  // The file contents, from either of the above.
+  const char *bytes_;
+  // The length of the file contents.
+  size_t length_;
+  // The current position within the file contents.
+  size_t pos_;
 };
 
 } // namespace Rust
@@ -283,16 +283,37 @@ Resolver::Resolver ()
   generate_builtins ();
 }
 
+static Resolver *instance = nullptr;
+
 Resolver *
 Resolver::get ()
 {
-  static Resolver *instance;
   if (instance == nullptr)
     instance = new Resolver ();
 
   return instance;
 }
 
+void
+Resolver::release ()
+{
+  delete instance;
+  instance = nullptr;
+}
+
+Resolver::~Resolver ()
+{
+  // label ribs share the type scope, so the same rib can be registered
+  // under more than one of these maps
+  std::set<Rib *> ribs;
+  for (auto &map : {&name_ribs, &type_ribs, &label_ribs, &macro_ribs})
+    for (auto &it : *map)
+      ribs.insert (it.second);
+
+  for (auto rib : ribs)
+    delete rib;
+}
+
 void
 Resolver::push_new_name_rib (Rib *r)
 {
@@ -122,7 +122,12 @@ class Resolver
 {
 public:
   static Resolver *get ();
-  ~Resolver () {}
+
+  // Destroys the resolver and its ribs; the next call to get () starts
+  // afresh.
+  static void release ();
+
+  ~Resolver ();
 
   // these builtin types
   void insert_builtin_types (Rib *r);
@@ -106,6 +106,10 @@ reference_type (tree to_type);
 tree
 immutable_type (tree base);
 
+// make pointer type restrict-qualified
+tree
+restrict_type (tree base);
+
 // Get a function type.  The receiver, parameter, and results are
 // generated from the types in the Function_type.  The Function_type
 // is provided so that the names are available.  This should return
@@ -459,6 +463,10 @@ static const unsigned int function_does_not_return = 1 << 2;
 // possible.  This is used for field tracking.
 static const unsigned int function_in_unique_section = 1 << 3;
 
+// Set if the function can never unwind, so that calls to it need no
+// landing pads.  This is set for all functions with -frust-panic=abort.
+static const unsigned int function_does_not_throw = 1 << 4;
+
 // Declare or define a function of FNTYPE.
 // NAME is the Go name of the function.  ASM_NAME, if not the empty
 // string, is the name that should be used in the symbol table; this
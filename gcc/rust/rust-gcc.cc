@@ -455,10 +455,24 @@ immutable_type (tree base)
 {
   if (base == error_mark_node)
     return error_mark_node;
-  tree constified = build_qualified_type (base, TYPE_QUAL_CONST);
+  tree constified
+    = build_qualified_type (base, TYPE_QUALS (base) | TYPE_QUAL_CONST);
   return constified;
 }
 
+// Get restrict-qualified type
+
+tree
+restrict_type (tree base)
+{
+  if (base == error_mark_node)
+    return error_mark_node;
+  gcc_assert (POINTER_TYPE_P (base));
+  tree restricted
+    = build_qualified_type (base, TYPE_QUALS (base) | TYPE_QUAL_RESTRICT);
+  return restricted;
+}
+
 // Make a function type.
 
 tree
@@ -2225,6 +2239,8 @@ function (tree functype, const std::string &name, const std::string &asm_name,
     TREE_THIS_VOLATILE (decl) = 1;
   if ((flags & function_in_unique_section) != 0)
     resolve_unique_section (decl, 0, 1);
+  if ((flags & function_does_not_throw) != 0)
+    TREE_NOTHROW (decl) = 1;
 
   rust_preserve_from_gc (decl);
   return decl;
@@ -37,6 +37,7 @@
 #include "rust-cfg-parser.h"
 #include "rust-privacy-ctx.h"
 #include "rust-ast-resolve-item.h"
+#include "rust-hir-fingerprint.h"
 #include "rust-lex.h"
 #include "optional.h"
 #include "rust-unicode.h"
@@ -441,6 +442,7 @@ run_rust_tests ()
   rust_privacy_ctx_test ();
   rust_crate_name_validation_test ();
   rust_simple_path_resolve_test ();
+  rust_hir_fingerprint_test ();
 }
 } // namespace selftest
 
@@ -26,6 +26,7 @@
 #include "rust-ast-lower.h"
 #include "rust-hir-type-check.h"
 #include "rust-privacy-check.h"
+#include "rust-privacy-reporter.h"
 #include "rust-const-checker.h"
 #include "rust-feature-gate.h"
 #include "rust-compile.h"
@@ -34,6 +35,7 @@
 #include "rust-lint-unused-var.h"
 #include "rust-readonly-check.h"
 #include "rust-hir-dump.h"
+#include "rust-hir-fingerprint.h"
 #include "rust-ast-dump.h"
 #include "rust-export-metadata.h"
 #include "rust-imports.h"
@@ -69,6 +71,7 @@ const char *kASTPrettyDumpFileExpanded = "gccrs.ast-pretty-expanded.dump";
 const char *kASTExpandedDumpFile = "gccrs.ast-expanded.dump";
 const char *kHIRDumpFile = "gccrs.hir.dump";
 const char *kHIRPrettyDumpFile = "gccrs.hir-pretty.dump";
+const char *kFingerprintDumpFile = "gccrs.fingerprints.dump";
 const char *kHIRTypeResolutionDumpFile = "gccrs.type-resolution.dump";
 const char *kTargetOptionsDumpFile = "gccrs.target-options.dump";
 
@@ -160,6 +163,10 @@ Session::init ()
   options.target_data.insert_key_value_pair ("target_endian", BYTES_BIG_ENDIAN
 								? "big"
 								: "little");
+  options.target_data.insert_key_value_pair (
+    "panic", options.get_panic_strategy () == CompileOptions::PanicStrategy::ABORT
+	       ? "abort"
+	       : "unwind");
 
   // setup singleton linemap
   linemap = rust_get_linemap ();
@@ -250,6 +257,9 @@ Session::handle_option (
     case OPT_frust_edition_:
       options.set_edition (flag_rust_edition);
       break;
+    case OPT_frust_panic_:
+      options.set_panic_strategy (flag_rust_panic);
+      break;
     case OPT_frust_compile_until_:
       options.set_compile_step (flag_rust_compile_until);
       break;
@@ -315,7 +325,7 @@ Session::enable_dump (std::string arg)
 	"dump option was not given a name. choose %<lex%>, %<ast-pretty%>, "
 	"%<register_plugins%>, %<injection%>, "
 	"%<expansion%>, %<resolution%>, %<target_options%>, %<hir%>, "
-	"%<hir-pretty%>, %<bir%> or %<all%>");
+	"%<hir-pretty%>, %<bir%>, %<fingerprints%> or %<all%>");
       return false;
     }
 
@@ -363,6 +373,10 @@ Session::enable_dump (std::string arg)
     {
       options.enable_dump_option (CompileOptions::BIR_DUMP);
     }
+  else if (arg == "fingerprints")
+    {
+      options.enable_dump_option (CompileOptions::FINGERPRINT_DUMP);
+    }
   else
     {
       rust_error_at (
@@ -370,7 +384,7 @@ Session::enable_dump (std::string arg)
 	"dump option %qs was unrecognised. choose %<lex%>, %<ast-pretty%>, "
 	"%<register_plugins%>, %<injection%>, "
 	"%<expansion%>, %<resolution%>, %<target_options%>, %<hir%>, "
-	"%<hir-pretty%>, or %<all%>",
+	"%<hir-pretty%>, %<bir%>, %<fingerprints%> or %<all%>",
 	arg.c_str ());
       return false;
     }
@@ -406,6 +420,14 @@ Session::handle_input_files (int num_files, const char **files)
 
   rust_debug ("Attempting to parse file: %s", file);
   compile_crate (file);
+
+  /* Everything the middle-end needs has been handed over as GENERIC, so free
+     the front-end state before optimization starts rather than carrying it
+     through to exit.  */
+  Resolver::TypeCheckContext::release ();
+  Resolver::Resolver::release ();
+  Analysis::Mappings::release ();
+  mappings = nullptr;
 }
 
 void
@@ -655,25 +677,41 @@ Session::compile_crate (const char *filename)
   if (saw_errors ())
     return;
 
+  if (options.dump_option_enabled (CompileOptions::FINGERPRINT_DUMP))
+    {
+      dump_fingerprints (hir);
+    }
+
   if (last_step == CompileOptions::CompileStep::Privacy)
     return;
 
-  // Various HIR error passes. The privacy pass happens before the unsafe checks
+  // Various HIR error passes. The privacy reporter needs the visibility of
+  // every item of the crate, so the item-level privacy passes run first
   Privacy::Resolver::resolve (hir);
   if (saw_errors ())
     return;
 
-  if (last_step == CompileOptions::CompileStep::Unsafety)
-    return;
-
-  HIR::UnsafeChecker ().go (hir);
-
-  if (last_step == CompileOptions::CompileStep::Const)
-    return;
-
-  HIR::ConstChecker ().go (hir);
-
-  if (last_step == CompileOptions::CompileStep::BorrowCheck)
+  // The privacy reporter, the unsafe checker and the const checker only need
+  // the node they are checking and the context they keep on the way down, so
+  // they share a single walk over the crate
+  auto resolver = Resolver::Resolver::get ();
+  auto ty_ctx = Resolver::TypeCheckContext::get ();
+  Privacy::PrivacyReporter privacy_reporter (*mappings, *resolver, *ty_ctx);
+  HIR::UnsafeChecker unsafe_checker;
+  HIR::ConstChecker const_checker;
+
+  HIR::FusedCheckWalker checks;
+  checks.add_pass (privacy_reporter);
+  if (last_step != CompileOptions::CompileStep::Unsafety)
+    checks.add_pass (unsafe_checker);
+  if (last_step != CompileOptions::CompileStep::Unsafety
+      && last_step != CompileOptions::CompileStep::Const)
+    checks.add_pass (const_checker);
+  checks.go (hir);
+
+  if (last_step == CompileOptions::CompileStep::Unsafety
+      || last_step == CompileOptions::CompileStep::Const
+      || last_step == CompileOptions::CompileStep::BorrowCheck)
     return;
 
   if (flag_borrowcheck)
@@ -696,7 +734,9 @@ Session::compile_crate (const char *filename)
   // we can't do static analysis if there are errors to worry about
   if (!saw_errors ())
     {
-      // lints
+      // lints. The dead code scan cannot join the checks above: it needs the
+      // liveness of every item, which MarkLive finds by following uses from
+      // the crate's roots rather than walking the crate in order
       Analysis::ScanDeadcode::Scan (hir);
       Analysis::UnusedVariables::Lint (ctx);
       Analysis::ReadonlyCheck::Lint (ctx);
@@ -1007,6 +1047,22 @@ Session::dump_hir_pretty (HIR::Crate &crate) const
   out.close ();
 }
 
+void
+Session::dump_fingerprints (HIR::Crate &crate) const
+{
+  std::ofstream out;
+  out.open (kFingerprintDumpFile);
+  if (out.fail ())
+    {
+      rust_error_at (UNKNOWN_LOCATION, "cannot open %s:%m; ignored",
+		     kFingerprintDumpFile);
+      return;
+    }
+
+  HIR::Fingerprinter::dump (crate, out);
+  out.close ();
+}
+
 // imports
 
 NodeId
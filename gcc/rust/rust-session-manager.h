@@ -222,6 +222,7 @@ struct CompileOptions
     HIR_DUMP,
     HIR_DUMP_PRETTY,
     BIR_DUMP,
+    FINGERPRINT_DUMP,
   };
 
   std::set<DumpOption> dump_options;
@@ -244,6 +245,14 @@ struct CompileOptions
   } edition
     = Edition::E2015;
 
+  enum class PanicStrategy
+  {
+    // Values defined in rust/lang.opt
+    UNWIND = 0,
+    ABORT,
+  } panic_strategy
+    = PanicStrategy::UNWIND;
+
   enum class CompileStep
   {
     Ast,
@@ -282,6 +291,7 @@ struct CompileOptions
     enable_dump_option (DumpOption::HIR_DUMP);
     enable_dump_option (DumpOption::HIR_DUMP_PRETTY);
     enable_dump_option (DumpOption::BIR_DUMP);
+    enable_dump_option (DumpOption::FINGERPRINT_DUMP);
   }
 
   void set_crate_name (std::string name)
@@ -304,6 +314,13 @@ struct CompileOptions
 
   const Edition &get_edition () const { return edition; }
 
+  void set_panic_strategy (int raw_strategy)
+  {
+    panic_strategy = static_cast<PanicStrategy> (raw_strategy);
+  }
+
+  const PanicStrategy &get_panic_strategy () const { return panic_strategy; }
+
   void set_crate_type (int raw_type) { target_data.set_crate_type (raw_type); }
 
   bool is_proc_macro () const
@@ -397,6 +414,7 @@ private:
   void dump_ast_pretty (AST::Crate &crate, bool expanded = false) const;
   void dump_hir (HIR::Crate &crate) const;
   void dump_hir_pretty (HIR::Crate &crate) const;
+  void dump_fingerprints (HIR::Crate &crate) const;
 
   // pipeline stages - TODO maybe move?
   /* Register plugins pipeline stage. TODO maybe move to another object?
@@ -36,11 +36,145 @@ MethodResolver::Probe (TyTy::BaseType *receiver,
 		       const HIR::PathIdentSegment &segment_name,
 		       bool autoderef_flag)
 {
+  // impl items whose types are still being queried are skipped during the
+  // probe so the result is only complete when no query is in progress
+  TypeCheckContext *context = TypeCheckContext::get ();
+  std::string key;
+  bool cacheable
+    = !context->have_query_in_progress () && probe_cache_key (receiver, key);
+  if (cacheable)
+    {
+      key += autoderef_flag ? "|autoderef|" : "|";
+      key += segment_name.as_string ();
+
+      const std::set<MethodCandidate> *cached = nullptr;
+      if (context->lookup_method_probe (key, &cached))
+	{
+	  // candidates from trait items are cloned for each probe, see
+	  // MethodResolver::select
+	  std::set<MethodCandidate> candidates;
+	  for (const auto &c : *cached)
+	    {
+	      MethodCandidate candidate = c;
+	      if (candidate.candidate.is_trait_candidate ())
+		candidate.candidate.ty = candidate.candidate.ty->clone ();
+	      candidates.insert (std::move (candidate));
+	    }
+	  return candidates;
+	}
+    }
+
   MethodResolver resolver (autoderef_flag, segment_name);
   resolver.cycle (receiver);
+
+  if (cacheable)
+    context->insert_method_probe (key, resolver.result);
+
   return resolver.result;
 }
 
+bool
+MethodResolver::probe_cache_key (const TyTy::BaseType *receiver,
+				 std::string &key)
+{
+  const TyTy::BaseType *ty = receiver->destructure ();
+
+  // bounds a concrete type inherits, e.g. through a qualified path, bring
+  // in candidates of their own in try_hook.  They are added to the type
+  // in place, so such a type only ever matches itself with the same bounds
+  const std::vector<TyTy::TypeBoundPredicate> &bounds
+    = ty->get_specified_bounds ();
+  if (!bounds.empty ())
+    {
+      key += "#" + std::to_string (ty->get_ref ());
+      for (const auto &bound : bounds)
+	key += "+" + bound.get_id ().as_string () + ":" + bound.as_string ();
+      key += "#";
+    }
+
+  switch (ty->get_kind ())
+    {
+    case TyTy::TypeKind::BOOL:
+    case TyTy::TypeKind::CHAR:
+    case TyTy::TypeKind::INT:
+    case TyTy::TypeKind::UINT:
+    case TyTy::TypeKind::FLOAT:
+    case TyTy::TypeKind::USIZE:
+    case TyTy::TypeKind::ISIZE:
+    case TyTy::TypeKind::STR:
+    case TyTy::TypeKind::NEVER:
+      key += ty->as_string ();
+      return true;
+
+      case TyTy::TypeKind::REF: {
+	const auto &ref = *static_cast<const TyTy::ReferenceType *> (ty);
+	key += ref.is_mutable () ? "&mut " : "&";
+	return probe_cache_key (ref.get_base (), key);
+      }
+
+      case TyTy::TypeKind::POINTER: {
+	const auto &ptr = *static_cast<const TyTy::PointerType *> (ty);
+	key += ptr.is_mutable () ? "*mut " : "*const ";
+	return probe_cache_key (ptr.get_base (), key);
+      }
+
+      case TyTy::TypeKind::SLICE: {
+	const auto &slice = *static_cast<const TyTy::SliceType *> (ty);
+	key += "[";
+	if (!probe_cache_key (slice.get_element_type (), key))
+	  return false;
+	key += "]";
+	return true;
+      }
+
+      case TyTy::TypeKind::TUPLE: {
+	const auto &tuple = *static_cast<const TyTy::TupleType *> (ty);
+	key += "(";
+	for (size_t i = 0; i < tuple.num_fields (); i++)
+	  {
+	    if (!probe_cache_key (tuple.get_field (i), key))
+	      return false;
+	    key += ",";
+	  }
+	key += ")";
+	return true;
+      }
+
+      case TyTy::TypeKind::ADT: {
+	const auto &adt = *static_cast<const TyTy::ADTType *> (ty);
+	const Resolver::CanonicalPath &path = adt.get_ident ().path;
+	if (path.is_empty () || adt.number_of_variants () == 0)
+	  return false;
+
+	// ADTs declared in different blocks can share a path, so also use
+	// the definition of their first variant to tell them apart
+	key += path.get ();
+	key += "@" + adt.get_variants ().at (0)->get_defid ().as_string ();
+	if (!adt.has_substitutions_defined ())
+	  return true;
+
+	// generic arguments which are still inference variables or
+	// parameters make the key fail above
+	key += "<";
+	for (const auto &subst : adt.get_substs ())
+	  {
+	    const TyTy::ParamType *param = subst.get_param_ty ();
+	    if (!probe_cache_key (param->resolve (), key))
+	      return false;
+	    key += ",";
+	  }
+	key += ">";
+	return true;
+      }
+
+    default:
+      // inference variables, generics, projections, closures and so on
+      // are not fully resolved, or their method candidates also depend on
+      // bounds which aren't part of the key
+      return false;
+    }
+}
+
 std::set<MethodCandidate>
 MethodResolver::Select (std::set<MethodCandidate> &candidates,
 			TyTy::BaseType *receiver,
@@ -120,14 +254,14 @@ MethodResolver::select (TyTy::BaseType &receiver)
   bool receiver_is_raw_ptr = raw->get_kind () == TyTy::TypeKind::POINTER;
   bool receiver_is_ref = raw->get_kind () == TyTy::TypeKind::REF;
 
-  // assemble inherent impl items
+  // assemble inherent impl items and the methods of trait impl blocks which
+  // override the trait's item, only visiting items with the right name
   std::vector<impl_item_candidate> inherent_impl_fns;
-  mappings->iterate_impl_items (
+  std::set<HirId> trait_impls_with_item;
+  const std::string &name = segment_name.as_string ();
+  mappings->iterate_impl_items_by_name (
+    name,
     [&] (HirId id, HIR::ImplItem *item, HIR::ImplBlock *impl) mutable -> bool {
-      bool is_trait_impl = impl->has_trait_ref ();
-      if (is_trait_impl)
-	return true;
-
       bool is_fn
 	= item->get_impl_item_type () == HIR::ImplItem::ImplItemType::FUNCTION;
       if (!is_fn)
@@ -137,12 +271,6 @@ MethodResolver::select (TyTy::BaseType &receiver)
       if (!func->is_method ())
 	return true;
 
-      bool name_matches = func->get_function_name ().as_string ().compare (
-			    segment_name.as_string ())
-			  == 0;
-      if (!name_matches)
-	return true;
-
       TyTy::BaseType *ty = nullptr;
       if (!query_type (func->get_mappings ().get_hirid (), &ty))
 	return true;
@@ -185,6 +313,8 @@ MethodResolver::select (TyTy::BaseType &receiver)
 	    return true;
 	}
 
+      if (impl->has_trait_ref ())
+	trait_impls_with_item.insert (impl->get_mappings ().get_hirid ());
       inherent_impl_fns.push_back ({func, impl, fnty});
 
       return true;
@@ -199,105 +329,56 @@ MethodResolver::select (TyTy::BaseType &receiver)
     const TraitItemReference *item_ref;
   };
 
-  std::vector<trait_item_candidate> trait_fns;
-  mappings->iterate_impl_blocks (
-    [&] (HirId id, HIR::ImplBlock *impl) mutable -> bool {
-      bool is_trait_impl = impl->has_trait_ref ();
-      if (!is_trait_impl)
-	return true;
+  // trait impl blocks which don't provide the method themselves can only
+  // match via the trait's item, so there is nothing to look for unless some
+  // trait declares an item of this name
+  bool trait_declares_item = false;
+  mappings->iterate_trait_items_by_name (
+    name, [&] (HIR::TraitItem *, HIR::Trait *) mutable -> bool {
+      trait_declares_item = true;
+      return false;
+    });
 
-      // look for impl implementation else lookup the associated trait item
-      for (auto &impl_item : impl->get_impl_items ())
-	{
-	  bool is_fn = impl_item->get_impl_item_type ()
-		       == HIR::ImplItem::ImplItemType::FUNCTION;
-	  if (!is_fn)
-	    continue;
-
-	  HIR::Function *func = static_cast<HIR::Function *> (impl_item.get ());
-	  if (!func->is_method ())
-	    continue;
-
-	  bool name_matches = func->get_function_name ().as_string ().compare (
-				segment_name.as_string ())
-			      == 0;
-	  if (!name_matches)
-	    continue;
-
-	  TyTy::BaseType *ty = nullptr;
-	  if (!query_type (func->get_mappings ().get_hirid (), &ty))
-	    continue;
-	  if (ty->get_kind () == TyTy::TypeKind::ERROR)
-	    continue;
-
-	  rust_assert (ty->get_kind () == TyTy::TypeKind::FNDEF);
-	  TyTy::FnType *fnty = static_cast<TyTy::FnType *> (ty);
-	  const TyTy::BaseType *impl_self
-	    = TypeCheckItem::ResolveImplBlockSelf (*impl);
-
-	  // see:
-	  // https://gcc-rust.zulipchat.com/#narrow/stream/266897-general/topic/Method.20Resolution/near/338646280
-	  // https://github.com/rust-lang/rust/blob/7eac88abb2e57e752f3302f02be5f3ce3d7adfb4/compiler/rustc_typeck/src/check/method/probe.rs#L650-L660
-	  bool impl_self_is_ptr
-	    = impl_self->get_kind () == TyTy::TypeKind::POINTER;
-	  bool impl_self_is_ref = impl_self->get_kind () == TyTy::TypeKind::REF;
-	  if (receiver_is_raw_ptr && impl_self_is_ptr)
-	    {
-	      const TyTy::PointerType &sptr
-		= *static_cast<const TyTy::PointerType *> (impl_self);
-	      const TyTy::PointerType &ptr
-		= *static_cast<const TyTy::PointerType *> (raw);
-
-	      // we could do this via lang-item assemblies if we refactor this
-	      bool mut_match = sptr.mutability () == ptr.mutability ();
-	      if (!mut_match)
-		continue;
-	    }
-	  else if (receiver_is_ref && impl_self_is_ref)
-	    {
-	      const TyTy::ReferenceType &sptr
-		= *static_cast<const TyTy::ReferenceType *> (impl_self);
-	      const TyTy::ReferenceType &ptr
-		= *static_cast<const TyTy::ReferenceType *> (raw);
-
-	      // we could do this via lang-item assemblies if we refactor this
-	      bool mut_match = sptr.mutability () == ptr.mutability ();
-	      if (!mut_match)
-		continue;
-	    }
+  std::vector<trait_item_candidate> trait_fns;
+  if (trait_declares_item)
+    mappings->iterate_impl_blocks (
+      [&] (HirId id, HIR::ImplBlock *impl) mutable -> bool {
+	bool is_trait_impl = impl->has_trait_ref ();
+	if (!is_trait_impl)
+	  return true;
 
-	  inherent_impl_fns.push_back ({func, impl, fnty});
+	// the impl implementation was already found above
+	if (trait_impls_with_item.find (id) != trait_impls_with_item.end ())
 	  return true;
-	}
 
-      TraitReference *trait_ref
-	= TraitResolver::Resolve (*impl->get_trait_ref ().get ());
-      rust_assert (!trait_ref->is_error ());
+	TraitReference *trait_ref
+	  = TraitResolver::Resolve (*impl->get_trait_ref ().get ());
+	rust_assert (!trait_ref->is_error ());
 
-      auto item_ref
-	= trait_ref->lookup_trait_item (segment_name.as_string (),
-					TraitItemReference::TraitItemType::FN);
-      if (item_ref->is_error ())
-	return true;
+	auto item_ref
+	  = trait_ref->lookup_trait_item (name,
+					  TraitItemReference::TraitItemType::FN);
+	if (item_ref->is_error ())
+	  return true;
 
-      const HIR::Trait *trait = trait_ref->get_hir_trait_ref ();
-      HIR::TraitItem *item = item_ref->get_hir_trait_item ();
-      if (item->get_item_kind () != HIR::TraitItem::TraitItemKind::FUNC)
-	return true;
+	const HIR::Trait *trait = trait_ref->get_hir_trait_ref ();
+	HIR::TraitItem *item = item_ref->get_hir_trait_item ();
+	if (item->get_item_kind () != HIR::TraitItem::TraitItemKind::FUNC)
+	  return true;
 
-      HIR::TraitItemFunc *func = static_cast<HIR::TraitItemFunc *> (item);
-      if (!func->get_decl ().is_method ())
-	return true;
+	HIR::TraitItemFunc *func = static_cast<HIR::TraitItemFunc *> (item);
+	if (!func->get_decl ().is_method ())
+	  return true;
 
-      TyTy::BaseType *ty = item_ref->get_tyty ();
-      rust_assert (ty->get_kind () == TyTy::TypeKind::FNDEF);
-      TyTy::FnType *fnty = static_cast<TyTy::FnType *> (ty);
+	TyTy::BaseType *ty = item_ref->get_tyty ();
+	rust_assert (ty->get_kind () == TyTy::TypeKind::FNDEF);
+	TyTy::FnType *fnty = static_cast<TyTy::FnType *> (ty);
 
-      trait_item_candidate candidate{func, trait, fnty, trait_ref, item_ref};
-      trait_fns.push_back (candidate);
+	trait_item_candidate candidate{func, trait, fnty, trait_ref, item_ref};
+	trait_fns.push_back (candidate);
 
-      return true;
-    });
+	return true;
+      });
 
   // lookup specified bounds for an associated item
   struct precdicate_candidate
@@ -77,6 +77,13 @@ private:
   std::vector<Adjustment>
   append_adjustments (const std::vector<Adjustment> &adjustments) const;
 
+  // the result of probing a fully resolved receiver type for a method name
+  // only depends on that type, its bounds and the name, so it is remembered
+  // in the TypeCheckContext under this key to avoid running the autoderef
+  // cycle again for each identical call
+  static bool probe_cache_key (const TyTy::BaseType *receiver,
+			       std::string &key);
+
 private:
   // search
   const HIR::PathIdentSegment &segment_name;
@@ -79,11 +79,16 @@ private:
   Item item;
 };
 
+struct MethodCandidate;
+
 class TypeCheckContext
 {
 public:
   static TypeCheckContext *get ();
 
+  // Destroys the context; the next call to get () starts afresh.
+  static void release ();
+
   ~TypeCheckContext ();
 
   bool lookup_builtin (NodeId id, TyTy::BaseType **type);
@@ -168,11 +173,17 @@ public:
   void insert_query (HirId id);
   void query_completed (HirId id);
   bool query_in_progress (HirId id) const;
+  bool have_query_in_progress () const;
 
   void insert_trait_query (DefId id);
   void trait_query_completed (DefId id);
   bool trait_query_in_progress (DefId id) const;
 
+  void insert_method_probe (const std::string &key,
+			    const std::set<MethodCandidate> &candidates);
+  bool lookup_method_probe (const std::string &key,
+			    const std::set<MethodCandidate> **candidates) const;
+
 private:
   TypeCheckContext ();
 
@@ -211,6 +222,9 @@ private:
   // query context lookups
   std::set<HirId> querys_in_progress;
   std::set<DefId> trait_queries_in_progress;
+
+  // method probes of fully resolved receiver types, see MethodResolver::Probe
+  std::map<std::string, std::set<MethodCandidate>> method_probes;
 };
 
 class TypeResolution
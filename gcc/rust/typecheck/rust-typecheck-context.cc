@@ -17,20 +17,29 @@
 // <http://www.gnu.org/licenses/>.
 
 #include "rust-hir-type-check.h"
+#include "rust-hir-dot-operator.h"
 
 namespace Rust {
 namespace Resolver {
 
+static TypeCheckContext *instance = nullptr;
+
 TypeCheckContext *
 TypeCheckContext::get ()
 {
-  static TypeCheckContext *instance;
   if (instance == nullptr)
     instance = new TypeCheckContext ();
 
   return instance;
 }
 
+void
+TypeCheckContext::release ()
+{
+  delete instance;
+  instance = nullptr;
+}
+
 TypeCheckContext::TypeCheckContext () {}
 
 TypeCheckContext::~TypeCheckContext () {}
@@ -477,6 +486,12 @@ TypeCheckContext::query_in_progress (HirId id) const
   return querys_in_progress.find (id) != querys_in_progress.end ();
 }
 
+bool
+TypeCheckContext::have_query_in_progress () const
+{
+  return !querys_in_progress.empty ();
+}
+
 void
 TypeCheckContext::insert_trait_query (DefId id)
 {
@@ -496,6 +511,25 @@ TypeCheckContext::trait_query_in_progress (DefId id) const
 	 != trait_queries_in_progress.end ();
 }
 
+void
+TypeCheckContext::insert_method_probe (
+  const std::string &key, const std::set<MethodCandidate> &candidates)
+{
+  method_probes[key] = candidates;
+}
+
+bool
+TypeCheckContext::lookup_method_probe (
+  const std::string &key, const std::set<MethodCandidate> **candidates) const
+{
+  auto it = method_probes.find (key);
+  if (it == method_probes.end ())
+    return false;
+
+  *candidates = &it->second;
+  return true;
+}
+
 // TypeCheckContextItem
 
 TypeCheckContextItem::Item::Item (HIR::Function *item) : item (item) {}
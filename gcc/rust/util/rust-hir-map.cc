@@ -106,18 +106,32 @@ Mappings::Mappings ()
 			  {}, {}, UNDEF_LOCATION);
 }
 
-Mappings::~Mappings () { delete builtinMarker; }
+Mappings::~Mappings ()
+{
+  delete builtinMarker;
+  for (auto &it : hir_crate_mappings)
+    delete it.second;
+  for (auto &it : ast_crate_mappings)
+    delete it.second;
+}
+
+static std::unique_ptr<Mappings> instance;
 
 Mappings *
 Mappings::get ()
 {
-  static std::unique_ptr<Mappings> instance;
   if (!instance)
     instance = std::unique_ptr<Mappings> (new Mappings ());
 
   return instance.get ();
 }
 
+void
+Mappings::release ()
+{
+  instance.reset ();
+}
+
 CrateNum
 Mappings::get_next_crate_num (const std::string &name)
 {
@@ -411,6 +425,7 @@ Mappings::insert_hir_trait_item (HIR::TraitItem *item)
   rust_assert (lookup_hir_trait_item (id) == nullptr);
 
   hirTraitItemMappings[id] = item;
+  hirTraitItemsByName[item->trait_identifier ()].push_back (id);
   insert_node_to_hir (item->get_mappings ().get_nodeid (), id);
 }
 
@@ -527,6 +542,7 @@ Mappings::insert_hir_implitem (HirId parent_impl_id, HIR::ImplItem *item)
 
   hirImplItemMappings[id]
     = std::pair<HirId, HIR::ImplItem *> (parent_impl_id, item);
+  hirImplItemsByName[item->get_impl_item_name ()].push_back (id);
   insert_node_to_hir (item->get_impl_mappings ().get_nodeid (), id);
 }
 
@@ -866,6 +882,42 @@ Mappings::iterate_trait_items (
     }
 }
 
+void
+Mappings::iterate_impl_items_by_name (
+  const std::string &name,
+  std::function<bool (HirId, HIR::ImplItem *, HIR::ImplBlock *)> cb)
+{
+  auto it = hirImplItemsByName.find (name);
+  if (it == hirImplItemsByName.end ())
+    return;
+
+  for (HirId id : it->second)
+    {
+      HIR::ImplItem *impl_item = lookup_hir_implitem (id, nullptr);
+      HIR::ImplBlock *impl = lookup_associated_impl (id);
+      if (!cb (id, impl_item, impl))
+	return;
+    }
+}
+
+void
+Mappings::iterate_trait_items_by_name (
+  const std::string &name,
+  std::function<bool (HIR::TraitItem *, HIR::Trait *)> cb)
+{
+  auto it = hirTraitItemsByName.find (name);
+  if (it == hirTraitItemsByName.end ())
+    return;
+
+  for (HirId id : it->second)
+    {
+      HIR::TraitItem *trait_item = lookup_hir_trait_item (id);
+      HIR::Trait *trait = lookup_trait_item_mapping (id);
+      if (!cb (trait_item, trait))
+	return;
+    }
+}
+
 void
 Mappings::insert_macro_def (AST::MacroRulesDefinition *macro)
 {
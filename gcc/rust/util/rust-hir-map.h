@@ -75,6 +75,11 @@ class Mappings
 {
 public:
   static Mappings *get ();
+
+  // Destroys the mappings along with the AST and HIR crates they own; the
+  // next call to get () starts afresh.
+  static void release ();
+
   ~Mappings ();
 
   CrateNum get_next_crate_num (const std::string &name);
@@ -205,6 +210,16 @@ public:
   void iterate_trait_items (
     std::function<bool (HIR::TraitItem *item, HIR::Trait *)> cb);
 
+  // like iterate_impl_items and iterate_trait_items but only visiting the
+  // items with the given name, which is what method resolution asks for
+  void iterate_impl_items_by_name (
+    const std::string &name,
+    std::function<bool (HirId, HIR::ImplItem *, HIR::ImplBlock *)> cb);
+
+  void iterate_trait_items_by_name (
+    const std::string &name,
+    std::function<bool (HIR::TraitItem *item, HIR::Trait *)> cb);
+
   bool is_impl_item (HirId id)
   {
     HirId parent_impl_block_id = UNKNOWN_HIRID;
@@ -382,6 +397,8 @@ private:
   std::map<HirId, HIR::ImplBlock *> hirImplBlockMappings;
   std::map<HirId, HIR::ImplBlock *> hirImplBlockTypeMappings;
   std::map<HirId, HIR::TraitItem *> hirTraitItemMappings;
+  std::map<std::string, std::vector<HirId>> hirImplItemsByName;
+  std::map<std::string, std::vector<HirId>> hirTraitItemsByName;
   std::map<HirId, HIR::ExternBlock *> hirExternBlockMappings;
   std::map<HirId, std::pair<HIR::ExternalItem *, HirId>> hirExternItemMappings;
   std::map<HirId, HIR::PathExprSegment *> hirPathSegMappings;
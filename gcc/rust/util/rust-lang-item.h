@@ -71,6 +71,9 @@ public:
     // https://github.com/rust-lang/rust/blob/master/library/core/src/marker.rs
     PHANTOM_DATA,
 
+    // https://github.com/rust-lang/rust/blob/master/library/core/src/cell.rs
+    UNSAFE_CELL,
+
     // functions
     FN,
     FN_MUT,
@@ -254,6 +257,10 @@ public:
       {
 	return ItemType::PHANTOM_DATA;
       }
+    else if (item.compare ("unsafe_cell") == 0)
+      {
+	return ItemType::UNSAFE_CELL;
+      }
     else if (item.compare ("fn") == 0)
       {
 	return ItemType::FN;
@@ -472,6 +479,8 @@ public:
 	return "RangeToInclusive";
       case PHANTOM_DATA:
 	return "phantom_data";
+      case UNSAFE_CELL:
+	return "unsafe_cell";
       case FN:
 	return "fn";
       case FN_MUT:
@@ -0,0 +1,106 @@
+// Copyright (C) 2020-2023 Free Software Foundation, Inc.
+
+// This file is part of GCC.
+
+// GCC is free software; you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3, or (at your option) any later
+// version.
+
+// GCC is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+// for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with GCC; see the file COPYING3.  If not see
+// <http://www.gnu.org/licenses/>.
+#ifndef RUST_STABLE_HASH_H
+#define RUST_STABLE_HASH_H
+
+#include "rust-system.h"
+#include "fnv-hash.h"
+
+namespace Rust {
+namespace Hash {
+
+/**
+ * A 128-bit content hash. Two fingerprints compare equal when the hashed
+ * contents were equal, modulo collisions.
+ */
+struct Fingerprint
+{
+  uint64_t hi;
+  uint64_t lo;
+
+  bool operator== (const Fingerprint &other) const
+  {
+    return hi == other.hi && lo == other.lo;
+  }
+
+  bool operator!= (const Fingerprint &other) const
+  {
+    return !(*this == other);
+  }
+
+  bool operator< (const Fingerprint &other) const
+  {
+    return hi < other.hi || (hi == other.hi && lo < other.lo);
+  }
+
+  // 32 lowercase hexadecimal digits, most significant first
+  std::string as_string () const
+  {
+    char buf[33];
+    snprintf (buf, sizeof (buf), "%016" PRIx64 "%016" PRIx64, hi, lo);
+    return std::string (buf);
+  }
+};
+
+/**
+ * Builds a Fingerprint out of a sequence of values. The result only depends
+ * on the values written and their order, never on the host or on where the
+ * values live in memory, so callers must not feed it pointers, NodeIds or
+ * HirIds. Every variable-length value is prefixed with its length so that
+ * distinct sequences cannot hash the same bytes.
+ */
+class StableHasher
+{
+public:
+  void write_u8 (uint8_t value) { fnv.write (&value, 1); }
+
+  void write_u64 (uint64_t value)
+  {
+    unsigned char buf[8];
+    for (size_t i = 0; i < sizeof (buf); i++)
+      buf[i] = (value >> (i * 8)) & 0xff;
+    fnv.write (buf, sizeof (buf));
+  }
+
+  void write_str (const std::string &str)
+  {
+    write_u64 (str.size ());
+    fnv.write ((const unsigned char *) str.data (), str.size ());
+  }
+
+  void write_fingerprint (const Fingerprint &fp)
+  {
+    write_u64 (fp.hi);
+    write_u64 (fp.lo);
+  }
+
+  Fingerprint finish () const
+  {
+    Fingerprint fp;
+    fnv.sum (&fp.hi, &fp.lo);
+    return fp;
+  }
+
+private:
+  FNV128 fnv;
+};
+
+} // namespace Hash
+} // namespace Rust
+
+#endif // RUST_STABLE_HASH_H
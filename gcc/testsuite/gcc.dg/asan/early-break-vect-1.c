@@ -0,0 +1,16 @@
+/* The vector loop reads before the first element, which ASan would
+   report.  */
+/* { dg-do compile { target i?86-*-* x86_64-*-* } } */
+/* { dg-skip-if "" { *-*-* } { "*" } { "-O3" } } */
+/* { dg-options "-fsanitize=address -msse4.1 -fdump-tree-vect-details" } */
+
+int
+find_int (int *p, int n, int x)
+{
+  for (int i = 0; i < n; i++)
+    if (p[i] == x)
+      return i;
+  return -1;
+}
+
+/* { dg-final { scan-tree-dump-not "loop with an early break vectorized" "vect" } } */
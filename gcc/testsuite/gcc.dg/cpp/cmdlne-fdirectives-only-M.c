@@ -0,0 +1,28 @@
+/* { dg-do preprocess } */
+/* { dg-options "-fdirectives-only -dM -M" } */
+
+/* Test that -fdirectives-only with dependency output only scans
+   directives, yet still follows conditionals and skips over comments
+   and literals.  */
+
+#define HAVE_MIC 1
+#if HAVE_MIC
+#include "mi1c.h"
+#endif
+
+#if 0
+#include "nonexistent-1.h"
+#endif
+
+/* A comment with a directive-looking line in it
+#include "nonexistent-2.h"
+*/
+const char *s = "a string with a continued line \
+#include \"nonexistent-3.h\"";
+int variable = 'c' + '/' + '"';
+
+/* { dg-final { scan-file cmdlne-fdirectives-only-M.i "(^|\\n)#define HAVE_MIC 1($|\\n)" } }
+   { dg-final { scan-file cmdlne-fdirectives-only-M.i "(^|\\n)#define CPP_MIC_H" } }
+   { dg-final { scan-file-not cmdlne-fdirectives-only-M.i "variable" } }
+   { dg-final { scan-file-not cmdlne-fdirectives-only-M.i "nonexistent" } }
+   { dg-final { scan-file cmdlne-fdirectives-only-M.i "(^|\\n)cmdlne-fdirectives-only-M\[^\\n\]*:( *\\\\\\n)?\[^\\n\]*cmdlne-fdirectives-only-M.c( *\\\\\\n)?\[^\\n\]*mi1c.h"} } */
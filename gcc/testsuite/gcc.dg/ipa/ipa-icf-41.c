@@ -0,0 +1,33 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -fno-strict-aliasing -fdump-ipa-icf-optimized" } */
+
+/* -fipa-icf-relaxed-types applies per function, so it can be enabled
+   for the functions to merge only.  */
+
+struct meters { double value; long count; int *next; };
+struct seconds { double value; long count; float *next; };
+
+__attribute__ ((noinline, optimize ("ipa-icf-relaxed-types")))
+double
+total_meters (struct meters m)
+{
+  return m.value * m.count;
+}
+
+__attribute__ ((noinline, optimize ("ipa-icf-relaxed-types")))
+double
+total_seconds (struct seconds s)
+{
+  return s.value * s.count;
+}
+
+int
+main (void)
+{
+  struct meters m = { 1.5, 2, 0 };
+  struct seconds s = { 2.5, 3, 0 };
+  return total_meters (m) + total_seconds (s) != 10.5;
+}
+
+/* { dg-final { scan-ipa-dump "Semantic equality hit:total_\[a-z\]+/\[0-9+\]+->total_\[a-z\]+/\[0-9+\]+" "icf" } } */
+/* { dg-final { scan-ipa-dump "Equal symbols: 1" "icf" } } */
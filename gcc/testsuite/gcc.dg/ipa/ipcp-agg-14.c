@@ -0,0 +1,50 @@
+/* Verify that IPA-CP can make a call through a function pointer loaded
+   from an array in an aggregate passed by value direct.  This is the
+   layout of a Rust trait object: a data pointer followed by the vtable
+   slots.  */
+/* { dg-do compile } */
+/* { dg-options "-O3 -fno-early-inlining -fno-ipa-sra -fdump-ipa-cp -fdump-ipa-inline"  } */
+
+typedef void (*slot) (void);
+
+struct dyn_shape
+{
+  void *data;
+  slot vtable[3];
+};
+
+struct circle
+{
+  double r;
+};
+
+extern void non_existent (double);
+
+static void circle_drop (void *p) { }
+static unsigned long circle_size (void *p) { return sizeof (struct circle); }
+
+static double
+circle_area (void *p)
+{
+  double r = ((struct circle *) p)->r;
+  non_existent (r);
+  return 3 * r * r;
+}
+
+static __attribute__ ((noinline)) double
+area (struct dyn_shape s)
+{
+  return ((double (*) (void *)) s.vtable[2]) (s.data);
+}
+
+double
+test (double r)
+{
+  struct circle c = { r };
+  struct dyn_shape s = { &c, { (slot) circle_drop, (slot) circle_size,
+			       (slot) circle_area } };
+  return area (s);
+}
+
+/* { dg-final { scan-ipa-dump "ipa-prop: Discovered an indirect call to a known target"  "cp"  } } */
+/* { dg-final { scan-ipa-dump "circle_area\[^\\n\]*inline copy in area"  "inline"  } } */
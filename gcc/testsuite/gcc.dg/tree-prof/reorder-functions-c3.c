@@ -0,0 +1,34 @@
+/* { dg-options "-O2 -freorder-functions-algorithm=call-chain-clustering -fdump-ipa-reorder" } */
+
+__attribute__ ((noinline)) static int
+leaf (int x)
+{
+  return x * 3 + 1;
+}
+
+__attribute__ ((noinline)) static int
+mid (int x)
+{
+  return leaf (x) ^ x;
+}
+
+__attribute__ ((noinline)) static int
+never (int x)
+{
+  return x - 1;
+}
+
+int
+main ()
+{
+  int r = 0;
+  for (int i = 0; i < 1000; i++)
+    r += mid (i);
+  if (r == 42)
+    r = never (r);
+  return r == 42;
+}
+
+/* { dg-final-use-not-autofdo { scan-ipa-dump "Appending cluster of leaf/\[0-9\]+ to cluster of mid/" "reorder" } } */
+/* { dg-final-use-not-autofdo { scan-ipa-dump "Appending cluster of mid/\[0-9\]+ to cluster of main/" "reorder" } } */
+/* { dg-final-use-not-autofdo { scan-ipa-dump-not "never/\[0-9\]+: " "reorder" } } */
@@ -0,0 +1,46 @@
+/* { dg-do run } */
+/* { dg-options "-O2 -fdump-tree-ldist-details" } */
+
+typedef __SIZE_TYPE__ size_t;
+extern void abort (void);
+
+__attribute__((noinline)) size_t
+find (const char *s, char c, size_t n)
+{
+  size_t i;
+  for (i = 0; i < n; ++i)
+    if (s[i] == c)
+      break;
+  return i;
+}
+
+__attribute__((noinline)) const unsigned char *
+find_newline (const unsigned char *p, const unsigned char *end)
+{
+  for (; p != end; ++p)
+    if (*p == '\n')
+      break;
+  return p;
+}
+
+static const char str[] = "hello\nworld";
+
+int
+main (void)
+{
+  const unsigned char *u = (const unsigned char *) str;
+
+  if (find (str, 'h', 11) != 0
+      || find (str, 'w', 11) != 6
+      || find (str, 'w', 6) != 6
+      || find (str, 'x', 11) != 11
+      || find (str, 'x', 0) != 0)
+    abort ();
+  if (find_newline (u, u + 11) != u + 5
+      || find_newline (u, u + 5) != u + 5
+      || find_newline (u + 6, u + 11) != u + 11)
+    abort ();
+  return 0;
+}
+
+/* { dg-final { scan-tree-dump-times "generated memchr" 2 "ldist" } } */
@@ -0,0 +1,54 @@
+/* { dg-do run } */
+/* { dg-options "-O2 -fdump-tree-ldist-details" } */
+
+/* A search in the first N characters of a slice, given by a pointer and
+   a length, with the bounds check of each access, as emitted by gccrs.  */
+
+typedef __SIZE_TYPE__ size_t;
+extern void abort (void);
+extern void exit (int);
+
+static size_t expected_index;
+
+__attribute__((noipa, noreturn)) void
+panic_bounds_check (size_t index, size_t len)
+{
+  if (index != expected_index || len != expected_index)
+    abort ();
+  exit (0);
+}
+
+__attribute__((noinline)) size_t
+position (const unsigned char *ptr, size_t len, unsigned char c, size_t n)
+{
+  size_t i;
+  for (i = 0; i < n; ++i)
+    {
+      if (i >= len)
+	panic_bounds_check (i, len);
+      if (ptr[i] == c)
+	break;
+    }
+  return i;
+}
+
+static const unsigned char str[] = "hello\nworld";
+
+int
+main (void)
+{
+  if (position (str, 11, 'h', 11) != 0
+      || position (str, 11, 'w', 11) != 6
+      || position (str, 11, 'w', 20) != 6
+      || position (str, 11, 'x', 11) != 11
+      || position (str, 11, 'x', 3) != 3
+      || position (str, 11, 'x', 0) != 0)
+    abort ();
+
+  /* Nothing is found in the slice, which is shorter than N.  */
+  expected_index = 5;
+  position (str, 5, 'w', 11);
+  abort ();
+}
+
+/* { dg-final { scan-tree-dump-times "generated memchr" 1 "ldist" } } */
@@ -0,0 +1,51 @@
+/* { dg-do run } */
+/* { dg-options "-O2 -fdump-tree-ldist-details" } */
+
+extern void abort (void);
+
+unsigned char a[32], b[32];
+int x[8], y[8];
+
+__attribute__((noinline)) int
+equal_bytes (void)
+{
+  for (int i = 0; i < 32; ++i)
+    if (a[i] != b[i])
+      return 0;
+  return 1;
+}
+
+__attribute__((noinline)) int
+equal_ints (void)
+{
+  for (int i = 0; i < 8; ++i)
+    if (x[i] != y[i])
+      return 0;
+  return 1;
+}
+
+/* The loop may stop reading before the end of unknown objects, so it
+   cannot be replaced.  */
+
+__attribute__((noinline)) int
+equal_ptrs (const int *p, const int *q, int n)
+{
+  for (int i = 0; i < n; ++i)
+    if (p[i] != q[i])
+      return 0;
+  return 1;
+}
+
+int
+main (void)
+{
+  if (!equal_bytes () || !equal_ints () || !equal_ptrs (x, y, 8))
+    abort ();
+  b[31] = 1;
+  y[0] = 1;
+  if (equal_bytes () || equal_ints () || equal_ptrs (x, y, 8))
+    abort ();
+  return 0;
+}
+
+/* { dg-final { scan-tree-dump-times "generated memcmp" 2 "ldist" } } */
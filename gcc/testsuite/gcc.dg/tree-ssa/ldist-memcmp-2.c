@@ -0,0 +1,75 @@
+/* { dg-do run } */
+/* { dg-options "-O2 -fdump-tree-ldist-details" } */
+
+/* Comparisons of the first N elements of two arrays or slices with the
+   bounds check of each access, as emitted by gccrs.  */
+
+extern void abort (void);
+extern void exit (int);
+
+unsigned char a[32], b[32];
+int x[8], y[8];
+
+static unsigned long expected_index;
+
+__attribute__((noipa, noreturn)) void
+panic_bounds_check (unsigned long index, unsigned long len)
+{
+  if (index != expected_index || len != 32)
+    abort ();
+  exit (0);
+}
+
+/* The bounds check limits the comparison to the arrays.  */
+
+__attribute__((noinline)) int
+equal_prefix (unsigned long n)
+{
+  for (unsigned long i = 0; i < n; ++i)
+    {
+      if (i >= 32)
+	panic_bounds_check (i, 32);
+      if (a[i] != b[i])
+	return 0;
+    }
+  return 1;
+}
+
+/* Nothing is known about the objects the slices point to, so the loop
+   cannot be replaced.  */
+
+__attribute__((noinline)) int
+equal_slices (const int *p, unsigned long plen, const int *q,
+	      unsigned long qlen, unsigned long n)
+{
+  for (unsigned long i = 0; i < n; ++i)
+    {
+      if (i >= plen)
+	panic_bounds_check (i, plen);
+      if (i >= qlen)
+	panic_bounds_check (i, qlen);
+      if (p[i] != q[i])
+	return 0;
+    }
+  return 1;
+}
+
+int
+main (void)
+{
+  if (!equal_prefix (0) || !equal_prefix (32) || !equal_slices (x, 8, y, 8, 8))
+    abort ();
+  b[20] = 1;
+  y[0] = 1;
+  if (!equal_prefix (20) || equal_prefix (21) || equal_prefix (40)
+      || equal_slices (x, 8, y, 8, 8))
+    abort ();
+
+  /* The arrays are equal but shorter than N.  */
+  b[20] = 0;
+  expected_index = 32;
+  equal_prefix (40);
+  abort ();
+}
+
+/* { dg-final { scan-tree-dump-times "generated memcmp" 1 "ldist" } } */
@@ -0,0 +1,56 @@
+/* { dg-do run } */
+/* { dg-options "-O2 -foutline-cold-paths --param outline-cold-paths-min-savings=4 -fdump-tree-coldoutline" } */
+
+extern void abort (void);
+
+struct failure
+{
+  const char *file;
+  int line;
+  long index, len;
+};
+
+static long data[16];
+
+static void __attribute__ ((noreturn, noinline))
+out_of_range (const struct failure *f, long last)
+{
+  abort ();
+}
+
+#define CHECK(i, n)							\
+  do									\
+    if ((i) >= (n))							\
+      {									\
+	struct failure f = { __FILE__, __LINE__, (i), (n) };		\
+	out_of_range (&f, (n) - 1);					\
+      }									\
+  while (0)
+
+long __attribute__ ((noinline))
+get (long i, long n)
+{
+  CHECK (i, n);
+  return data[i];
+}
+
+long __attribute__ ((noinline))
+get2 (long i, long j, long n)
+{
+  CHECK (i, n);
+  CHECK (j, n);
+  return data[i] + data[j];
+}
+
+int
+main (void)
+{
+  data[1] = 1;
+  data[2] = 2;
+  if (get (1, 16) + get2 (1, 2, 16) != 4)
+    abort ();
+  return 0;
+}
+
+/* The abort calls are too small to be worth outlining.  */
+/* { dg-final { scan-tree-dump-times "Outlining bb" 3 "coldoutline" } } */
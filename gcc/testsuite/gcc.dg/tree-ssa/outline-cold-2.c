@@ -0,0 +1,31 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -g -foutline-cold-paths --param outline-cold-paths-min-savings=4 -fcompare-debug -fdump-tree-coldoutline" } */
+
+/* Debug binds of the variables moved into the outlined function must
+   neither stop the outlining nor survive in the caller.  */
+
+struct failure
+{
+  const char *file;
+  int line;
+  long index, len;
+};
+
+extern long data[16];
+
+extern void __attribute__ ((noreturn)) out_of_range (const struct failure *,
+						      long);
+
+long
+get (long i, long n)
+{
+  if (i >= n)
+    {
+      struct failure f = { __FILE__, __LINE__, i, n };
+      long last = n - 1;
+      out_of_range (&f, last);
+    }
+  return data[i];
+}
+
+/* { dg-final { scan-tree-dump-times "Outlining bb" 1 "coldoutline" } } */
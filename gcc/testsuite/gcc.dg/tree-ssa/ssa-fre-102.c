@@ -0,0 +1,28 @@
+/* { dg-do compile } */
+/* { dg-options "-O2 -fdump-tree-fre1" } */
+
+/* A call through a function pointer loaded from an aggregate built in the
+   same function, as in a call through a Rust trait object, is made
+   direct.  */
+
+typedef void (*slot) (void);
+
+struct dyn_shape
+{
+  void *data;
+  slot vtable[3];
+};
+
+extern void circle_drop (void *);
+extern unsigned long circle_size (void *);
+extern double circle_area (void *);
+
+double
+test (void *c)
+{
+  struct dyn_shape s = { c, { (slot) circle_drop, (slot) circle_size,
+			      (slot) circle_area } };
+  return ((double (*) (void *)) s.vtable[2]) (s.data);
+}
+
+/* { dg-final { scan-tree-dump "= circle_area \\(c" "fre1" } } */
@@ -0,0 +1,32 @@
+/* { dg-do compile } */
+/* { dg-options "-O3 -msse4.1 -fdump-tree-vect-details" } */
+
+int __attribute__ ((noipa))
+find_int (int *p, int n, int x)
+{
+  for (int i = 0; i < n; i++)
+    if (p[i] == x)
+      return i;
+  return -1;
+}
+
+int __attribute__ ((noipa))
+any_greater (int *p, int n, int x)
+{
+  for (int i = 0; i < n; i++)
+    if (p[i] > x)
+      return 1;
+  return 0;
+}
+
+int __attribute__ ((noipa))
+all_equal (long long *p, int n, long long x)
+{
+  for (int i = 0; i < n; i++)
+    if (p[i] != x)
+      return 0;
+  return 1;
+}
+
+/* { dg-final { scan-tree-dump-times "loop with an early break vectorized" 3 "vect" } } */
+/* { dg-final { scan-assembler "ptest" } } */
@@ -0,0 +1,49 @@
+/* { dg-do run } */
+/* { dg-options "-O3 -msse4.1" } */
+/* { dg-require-effective-target sse4 } */
+
+#include "sse4_1-check.h"
+
+#include "sse4_1-vect-early-break-1.c"
+
+#define N 80
+
+static int a[N] __attribute__ ((aligned (16)));
+static long long b[N] __attribute__ ((aligned (16)));
+
+/* Fill the N elements from START with IN, except the one at POS which is
+   set to HIT, and the elements around them with OUT.  */
+
+static void
+fill (int start, int n, int pos, int in, int hit, int out)
+{
+  for (int i = 0; i < N; i++)
+    {
+      int val = i < start || i >= start + n ? out : i - start == pos ? hit : in;
+      a[i] = val;
+      b[i] = val;
+    }
+}
+
+static void
+sse4_1_test (void)
+{
+  for (int start = 0; start < 8; start++)
+    for (int n = 0; n < N - 8; n++)
+      for (int pos = -1; pos <= n; pos++)
+	{
+	  int found = pos >= 0 && pos < n;
+
+	  fill (start, n, pos, 7, 42, 42);
+	  if (find_int (a + start, n, 42) != (found ? pos : -1))
+	    abort ();
+
+	  fill (start, n, pos, 7, 2000, 5000);
+	  if (any_greater (a + start, n, 1000) != found)
+	    abort ();
+
+	  fill (start, n, pos, 7, 8, 9);
+	  if (all_equal (b + start, n, 7) != !found)
+	    abort ();
+	}
+}
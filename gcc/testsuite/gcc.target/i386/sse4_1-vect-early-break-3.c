@@ -0,0 +1,14 @@
+/* { dg-do compile } */
+/* { dg-options "-O3 -msse4.1 -fdump-tree-vect-details --param min-vect-loop-bound=10" } */
+
+int __attribute__ ((noipa))
+find_int (int *p, int n, int x)
+{
+  for (int i = 0; i < n; i++)
+    if (p[i] == x)
+      return i;
+  return -1;
+}
+
+/* { dg-final { scan-tree-dump "Runtime profitability threshold = 40" "vect" } } */
+/* { dg-final { scan-tree-dump "loop with an early break vectorized" "vect" } } */
@@ -0,0 +1,14 @@
+/* { dg-do compile } */
+/* { dg-options "-O3 -msse4.1 -fvect-cost-model=unlimited -fdump-tree-vect-details" } */
+
+int __attribute__ ((noipa))
+find_int (int *p, int n, int x)
+{
+  for (int i = 0; i < n; i++)
+    if (p[i] == x)
+      return i;
+  return -1;
+}
+
+/* { dg-final { scan-tree-dump-not "Cost model analysis for the early break loop" "vect" } } */
+/* { dg-final { scan-tree-dump "loop with an early break vectorized" "vect" } } */
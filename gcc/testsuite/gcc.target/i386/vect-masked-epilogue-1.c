@@ -0,0 +1,12 @@
+/* { dg-do compile { target { ! ia32 } } } */
+/* { dg-options "-O3 -march=sapphirerapids -fdump-tree-vect-details" } */
+
+void
+foo (unsigned char *__restrict a, unsigned char *__restrict b, int n)
+{
+  for (int i = 0; i < n; ++i)
+    a[i] = b[i] + 1;
+}
+
+/* { dg-final { scan-tree-dump "operating on partial vectors for epilogue loop" "vect" } } */
+/* { dg-final { scan-assembler "bzhi" } } */
@@ -0,0 +1,47 @@
+/* { dg-do run } */
+/* { dg-options "-O3 -mavx512bw -mavx512vl -mbmi2 -mtune-ctrl=avx512_masked_epilogues" } */
+/* { dg-require-effective-target avx512bw } */
+
+#include "avx512bw-check.h"
+
+#define N 200
+
+unsigned char a[N + 1], b[N];
+int c[N + 1], d[N];
+
+__attribute__((noipa)) void
+add_bytes (unsigned char *__restrict x, unsigned char *__restrict y, int n)
+{
+  for (int i = 0; i < n; ++i)
+    x[i] = y[i] + 1;
+}
+
+__attribute__((noipa)) void
+add_ints (int *__restrict x, int *__restrict y, int n)
+{
+  for (int i = 0; i < n; ++i)
+    x[i] = y[i] + 1;
+}
+
+void
+avx512bw_test ()
+{
+  for (int n = 0; n <= N; ++n)
+    {
+      for (int i = 0; i < N; ++i)
+	{
+	  a[i] = c[i] = 0;
+	  b[i] = d[i] = i;
+	}
+      a[n] = c[n] = 42;
+
+      add_bytes (a, b, n);
+      add_ints (c, d, n);
+
+      for (int i = 0; i < n; ++i)
+	if (a[i] != (unsigned char) (i + 1) || c[i] != i + 1)
+	  abort ();
+      if (a[n] != 42 || c[n] != 42)
+	abort ();
+    }
+}
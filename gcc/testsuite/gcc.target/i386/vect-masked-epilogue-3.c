@@ -0,0 +1,13 @@
+/* { dg-do compile { target { ! ia32 } } } */
+/* { dg-options "-O3 -march=znver4 -fdump-tree-vect-details" } */
+
+/* Masked epilogues are used by default for znver4.  */
+
+void
+foo (unsigned char *__restrict a, unsigned char *__restrict b, int n)
+{
+  for (int i = 0; i < n; ++i)
+    a[i] = b[i] + 1;
+}
+
+/* { dg-final { scan-tree-dump "operating on partial vectors for epilogue loop" "vect" } } */
@@ -0,0 +1,13 @@
+/* { dg-do compile } */
+/* { dg-options "-O3 -mavx512bw -mbmi2 -mtune=generic -fdump-tree-vect-details" } */
+
+/* Masked epilogues are not used with generic tuning.  */
+
+void
+foo (unsigned char *__restrict a, unsigned char *__restrict b, int n)
+{
+  for (int i = 0; i < n; ++i)
+    a[i] = b[i] + 1;
+}
+
+/* { dg-final { scan-tree-dump-not "operating on partial vectors for epilogue loop" "vect" } } */
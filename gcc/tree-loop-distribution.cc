@@ -110,6 +110,7 @@ along with GCC; see the file COPYING3.  If not see
 #include "tree-ssa-loop.h"
 #include "tree-into-ssa.h"
 #include "tree-ssa.h"
+#include "tree-dfa.h"
 #include "cfgloop.h"
 #include "tree-scalar-evolution.h"
 #include "tree-vectorizer.h"
@@ -659,6 +660,10 @@ class loop_distribution
      replace them accordingly.  */
   bool transform_reduction_loop (loop_p loop);
 
+  /* Transform loops with an early exit which mimic the effects of builtins
+     memchr or memcmp and replace them accordingly.  */
+  bool transform_early_exit_loop (loop_p loop);
+
   /* Compute topological order for basic blocks.  Topological order is
      needed because data dependence is computed for data references in
      lexicographical order.  */
@@ -3764,6 +3769,625 @@ loop_distribution::transform_reduction_loop (loop_p loop)
   return false;
 }
 
+/* Return true if VAR is an SSA name defined by a statement in LOOP.  */
+
+static bool
+ssa_defined_in_loop_p (loop_p loop, tree var)
+{
+  return (TREE_CODE (var) == SSA_NAME
+	  && !SSA_NAME_IS_DEFAULT_DEF (var)
+	  && flow_bb_inside_loop_p (loop, gimple_bb (SSA_NAME_DEF_STMT (var))));
+}
+
+/* Return true if DEF, defined in LOOP, is used after LOOP only by PHI nodes
+   on the exits of LOOP.  */
+
+static bool
+used_only_on_exits_p (loop_p loop, tree def)
+{
+  imm_use_iterator iter;
+  use_operand_p use_p;
+  FOR_EACH_IMM_USE_FAST (use_p, iter, def)
+    {
+      gimple *use_stmt = USE_STMT (use_p);
+      if (is_gimple_debug (use_stmt)
+	  || flow_bb_inside_loop_p (loop, gimple_bb (use_stmt)))
+	continue;
+      gphi *phi = dyn_cast <gphi *> (use_stmt);
+      if (!phi
+	  || !loop_exit_edge_p (loop,
+				gimple_phi_arg_edge (phi,
+						     PHI_ARG_INDEX_FROM_USE
+						       (use_p))))
+	return false;
+    }
+  return true;
+}
+
+/* Return true if the statements in BBS, the body of LOOP, have no side
+   effects and if the values they compute are only used after LOOP on its
+   exits.  */
+
+static bool
+early_exit_loop_body_p (loop_p loop, basic_block *bbs)
+{
+  for (unsigned i = 0; i < loop->num_nodes; ++i)
+    {
+      for (gphi_iterator gsi = gsi_start_phis (bbs[i]); !gsi_end_p (gsi);
+	   gsi_next (&gsi))
+	{
+	  tree res = gimple_phi_result (gsi.phi ());
+	  if (!virtual_operand_p (res) && !used_only_on_exits_p (loop, res))
+	    return false;
+	}
+
+      for (gimple_stmt_iterator gsi = gsi_start_bb (bbs[i]); !gsi_end_p (gsi);
+	   gsi_next (&gsi))
+	{
+	  gimple *stmt = gsi_stmt (gsi);
+	  if (is_gimple_debug (stmt) || gimple_code (stmt) == GIMPLE_LABEL)
+	    continue;
+	  if (is_gimple_call (stmt)
+	      || gimple_code (stmt) == GIMPLE_ASM
+	      || gimple_vdef (stmt)
+	      || gimple_has_side_effects (stmt)
+	      || gimple_has_volatile_ops (stmt))
+	    return false;
+
+	  ssa_op_iter iter;
+	  tree def;
+	  FOR_EACH_SSA_TREE_OPERAND (def, stmt, iter, SSA_OP_DEF)
+	    if (!used_only_on_exits_p (loop, def))
+	      return false;
+	}
+    }
+
+  return true;
+}
+
+/* A loop searching for an element or comparing the elements of two
+   arrays.  */
+
+struct early_exit_info
+{
+  /* The exit taken when the element is found or the elements differ.  */
+  edge found_exit;
+
+  /* The loads of the elements, LOADS[1] being NULL for searches, and the
+     addresses they access in the first iteration.  */
+  gassign *loads[2];
+  tree bases[2];
+
+  /* For searches, the SSA name tested by the exit condition, the loop
+     invariant value it is compared with, and that value converted to the
+     type of the elements.  */
+  tree op;
+  tree value;
+  tree pattern;
+};
+
+/* If VAR is defined in LOOP by a load of an integer element, the loads of
+   consecutive iterations accessing consecutive elements, return the load
+   and set *BASE to the address of the element loaded in the first
+   iteration.  */
+
+static gassign *
+early_exit_load (loop_p loop, tree var, tree *base)
+{
+  if (!ssa_defined_in_loop_p (loop, var))
+    return NULL;
+
+  gassign *load = dyn_cast <gassign *> (SSA_NAME_DEF_STMT (var));
+  if (!load || !gimple_assign_load_p (load))
+    return NULL;
+
+  tree ref = gimple_assign_rhs1 (load);
+  tree type = TREE_TYPE (ref);
+  if (!INTEGRAL_TYPE_P (type)
+      || !type_has_mode_precision_p (type)
+      || TREE_CODE (ref) == BIT_FIELD_REF
+      || contains_bitfld_component_ref_p (ref))
+    return NULL;
+
+  affine_iv iv;
+  if (!simple_iv (loop, loop, build_fold_addr_expr (ref), &iv, false)
+      || !operand_equal_p (iv.step, TYPE_SIZE_UNIT (type), 0))
+    return NULL;
+
+  *base = iv.base;
+  return load;
+}
+
+/* Return true if LOOP is left through E when the character loaded in the
+   current iteration equals a loop invariant value, or when the elements
+   loaded from two arrays differ.  Fill in INFO accordingly.  */
+
+static bool
+analyze_early_exit_cond (loop_p loop, edge e, early_exit_info *info)
+{
+  gcond *cond = safe_dyn_cast <gcond *> (last_stmt (e->src));
+  if (!cond
+      || (gimple_cond_code (cond) != EQ_EXPR
+	  && gimple_cond_code (cond) != NE_EXPR))
+    return false;
+
+  bool exit_on_eq_p = ((gimple_cond_code (cond) == EQ_EXPR)
+		       == ((e->flags & EDGE_TRUE_VALUE) != 0));
+  tree lhs = gimple_cond_lhs (cond);
+  tree rhs = gimple_cond_rhs (cond);
+  if (!ssa_defined_in_loop_p (loop, lhs))
+    std::swap (lhs, rhs);
+  if (!ssa_defined_in_loop_p (loop, lhs))
+    return false;
+
+  info->found_exit = e;
+  if (!exit_on_eq_p)
+    {
+      info->loads[0] = early_exit_load (loop, lhs, &info->bases[0]);
+      info->loads[1] = early_exit_load (loop, rhs, &info->bases[1]);
+      return info->loads[0] && info->loads[1];
+    }
+
+  if (!expr_invariant_in_loop_p (loop, rhs))
+    return false;
+
+  /* The loaded character may have been widened for the comparison with a
+     constant.  */
+  tree var = lhs;
+  gassign *conv = dyn_cast <gassign *> (SSA_NAME_DEF_STMT (lhs));
+  if (conv
+      && CONVERT_EXPR_CODE_P (gimple_assign_rhs_code (conv))
+      && TREE_CODE (rhs) == INTEGER_CST)
+    var = gimple_assign_rhs1 (conv);
+
+  info->loads[0] = early_exit_load (loop, var, &info->bases[0]);
+  info->loads[1] = NULL;
+  if (!info->loads[0])
+    return false;
+
+  tree type = TREE_TYPE (var);
+  if (TYPE_MODE (type) != TYPE_MODE (char_type_node)
+      || TYPE_PRECISION (type) != TYPE_PRECISION (char_type_node))
+    return false;
+  if (var != lhs
+      && (!INTEGRAL_TYPE_P (TREE_TYPE (lhs))
+	  || TYPE_PRECISION (TREE_TYPE (lhs)) < TYPE_PRECISION (type)
+	  || !int_fits_type_p (rhs, type)))
+    return false;
+
+  info->op = lhs;
+  info->value = rhs;
+  info->pattern = fold_convert (type, rhs);
+  return true;
+}
+
+/* Return the value VAR has after LOOP, described by INFO, when LOOP is left
+   after K executions of its latch through the exit taken when the element
+   is found if FOUND_P, or through the other exit otherwise.  Return
+   NULL_TREE if the value cannot be computed.  */
+
+static tree
+early_exit_value (loop_p loop, const early_exit_info *info, bool found_p,
+		  tree var, tree k)
+{
+  if (!ssa_defined_in_loop_p (loop, var))
+    return var;
+
+  if (found_p)
+    {
+      /* Nothing is known about where two arrays differ.  */
+      if (info->loads[1])
+	return NULL_TREE;
+      if (var == info->op)
+	return info->value;
+      if (var == gimple_assign_lhs (info->loads[0]))
+	return fold_convert (TREE_TYPE (var), info->pattern);
+    }
+
+  affine_iv iv;
+  if (!simple_iv (loop, loop, var, &iv, false))
+    return NULL_TREE;
+
+  tree type = TREE_TYPE (var);
+  if (POINTER_TYPE_P (type))
+    return fold_build_pointer_plus (iv.base,
+				    fold_build2 (MULT_EXPR, sizetype, k,
+						 fold_convert (sizetype,
+							       iv.step)));
+  if (!INTEGRAL_TYPE_P (type))
+    return NULL_TREE;
+
+  /* Compute the value in an unsigned type to avoid introducing undefined
+     overflow.  */
+  tree utype = unsigned_type_for (type);
+  tree val = fold_build2 (MULT_EXPR, utype, fold_convert (utype, k),
+			  fold_convert (utype, iv.step));
+  val = fold_build2 (PLUS_EXPR, utype, fold_convert (utype, iv.base), val);
+  return fold_convert (type, val);
+}
+
+/* Return true if the SIZE bytes starting at ADDR are known to be part of a
+   single declared object.  */
+
+static bool
+addr_range_within_object_p (tree addr, tree size)
+{
+  poly_int64 offset = 0;
+  if (TREE_CODE (addr) == POINTER_PLUS_EXPR)
+    {
+      if (!tree_fits_poly_int64_p (TREE_OPERAND (addr, 1)))
+	return false;
+      offset = tree_to_poly_int64 (TREE_OPERAND (addr, 1));
+      addr = TREE_OPERAND (addr, 0);
+    }
+  if (TREE_CODE (addr) != ADDR_EXPR)
+    return false;
+
+  poly_int64 ref_offset;
+  tree base = get_addr_base_and_unit_offset (TREE_OPERAND (addr, 0),
+					     &ref_offset);
+  if (!base
+      || !DECL_P (base)
+      || !DECL_SIZE_UNIT (base)
+      || !tree_fits_poly_int64_p (DECL_SIZE_UNIT (base))
+      || !tree_fits_poly_int64_p (size))
+    return false;
+
+  offset += ref_offset;
+  return (known_ge (offset, 0)
+	  && known_le (offset + tree_to_poly_int64 (size),
+		       tree_to_poly_int64 (DECL_SIZE_UNIT (base))));
+}
+
+/* qsort comparator ordering the exits of a loop, whose sources all dominate
+   the latch of the loop, in the order they are tested.  */
+
+static int
+exit_test_order_cmp (const void *p1, const void *p2)
+{
+  const_edge e1 = *(const const_edge *) p1;
+  const_edge e2 = *(const const_edge *) p2;
+  if (e1->src == e2->src)
+    return 0;
+  return dominated_by_p (CDI_DOMINATORS, e2->src, e1->src) ? -1 : 1;
+}
+
+/* Transform loops which mimic the effects of builtins memchr or memcmp and
+   replace them accordingly.  One exit has to test the loaded elements and
+   the others have to be controlled by counters, all once per iteration.
+   For example, the loop
+
+     for (i = 0; i < n; ++i)
+       if (s[i] == c)
+	 break;
+
+   where S is a character array is replaced by
+
+     q = memchr (s, c, n);
+     if (q != 0)
+       i = q - s;
+     else
+       i = n;
+
+   and the loop
+
+     for (i = 0; i < 32; ++i)
+       if (a[i] != b[i])
+	 return false;
+     return true;
+
+   is replaced by
+
+     return __builtin_memcmp_eq (a, b, 32 * sizeof (a[0])) == 0;
+
+   There may be several counted exits, such as the bounds checks guarding
+   the accesses to a slice or an array.  The elements are then searched or
+   compared up to the first of them taken, and that exit is taken after the
+   call when the element is not found.  In
+
+     for (i = 0; i < n; ++i)
+       {
+	 if (i >= len)
+	   panic_bounds_check (i, len);
+	 if (s[i] == c)
+	   break;
+       }
+
+   memchr searches MIN (n, len) characters, and the panic is reached when C
+   is not found and N is larger than LEN.
+
+   Unlike the loop, memcmp may access all the bytes of both arrays, so it is
+   only used if they are known to be part of declared objects for any number
+   of iterations the counted exits allow, which a bounds check against the
+   size of a fixed-size array is enough to prove.  Values computed in the
+   loop and used after it have to be induction variables or, when the
+   searched character is found, that character.  */
+
+bool
+loop_distribution::transform_early_exit_loop (loop_p loop)
+{
+  auto_vec<edge> exits = get_loop_exit_edges (loop);
+  if (exits.length () < 2)
+    return false;
+  for (edge e : exits)
+    if ((e->flags & EDGE_COMPLEX)
+	|| !dominated_by_p (CDI_DOMINATORS, loop->latch, e->src))
+      return false;
+
+  basic_block *bbs = get_loop_body (loop);
+  bool body_ok_p = early_exit_loop_body_p (loop, bbs);
+  free (bbs);
+  if (!body_ok_p)
+    return false;
+
+  exits.qsort (exit_test_order_cmp);
+
+  early_exit_info info;
+  unsigned i, found;
+  for (found = 0; found < exits.length (); ++found)
+    if (analyze_early_exit_cond (loop, exits[found], &info))
+      break;
+  if (found == exits.length ())
+    return false;
+
+  /* Compute the number of executions of the latch before each of the other
+     exits is taken, assuming it is the only one.  The elements are tested
+     once per execution of the latch, plus once more if they are tested
+     before the exit.  MAX_NELTS is an upper bound of the number of elements
+     tested before the first counted exit is taken; make sure that it can be
+     represented.  */
+  auto_vec<edge> count_exits;
+  auto_vec<tree> niters;
+  widest_int max_nelts = -1;
+  for (i = 0; i < exits.length (); ++i)
+    {
+      if (i == found)
+	continue;
+
+      class tree_niter_desc niter_desc;
+      if (!number_of_iterations_exit (loop, exits[i], &niter_desc, false, true)
+	  || !wi::ltu_p (niter_desc.max,
+			 wi::to_widest (TYPE_MAX_VALUE (sizetype))))
+	return false;
+
+      tree niter = fold_convert (sizetype, niter_desc.niter);
+      if (!integer_zerop (niter_desc.may_be_zero))
+	niter = fold_build3 (COND_EXPR, sizetype, niter_desc.may_be_zero,
+			     size_zero_node, niter);
+      count_exits.safe_push (exits[i]);
+      niters.safe_push (niter);
+
+      widest_int exit_max_nelts = niter_desc.max + (i > found ? 1 : 0);
+      if (max_nelts == -1 || wi::ltu_p (exit_max_nelts, max_nelts))
+	max_nelts = exit_max_nelts;
+    }
+
+  tree elt_type = TREE_TYPE (gimple_assign_lhs (info.loads[0]));
+  tree fn;
+  if (info.loads[1])
+    {
+      widest_int max_size
+	= max_nelts * wi::to_widest (TYPE_SIZE_UNIT (elt_type));
+      if (!wi::ltu_p (max_size, wi::to_widest (TYPE_MAX_VALUE (sizetype))))
+	return false;
+      tree max_size_cst = wide_int_to_tree (sizetype, max_size);
+      if (!addr_range_within_object_p (info.bases[0], max_size_cst)
+	  || !addr_range_within_object_p (info.bases[1], max_size_cst)
+	  || !builtin_decl_implicit_p (BUILT_IN_MEMCMP))
+	return false;
+      fn = builtin_decl_explicit (BUILT_IN_MEMCMP_EQ);
+    }
+  else
+    {
+      fn = builtin_decl_implicit (BUILT_IN_MEMCHR);
+      if (!fn)
+	return false;
+    }
+
+  /* Check that the values used after the loop can be computed.  */
+  for (edge e : exits)
+    for (gphi_iterator gsi = gsi_start_phis (e->dest); !gsi_end_p (gsi);
+	 gsi_next (&gsi))
+      {
+	gphi *phi = gsi.phi ();
+	if (!virtual_operand_p (gimple_phi_result (phi))
+	    && !early_exit_value (loop, &info, e == info.found_exit,
+				  PHI_ARG_DEF_FROM_EDGE (phi, e),
+				  size_zero_node))
+	  return false;
+      }
+
+  /* The new statements will be placed before LOOP.  */
+  basic_block preheader = loop_preheader_edge (loop)->src;
+  gimple_stmt_iterator gsi = gsi_last_bb (preheader);
+  location_t loc = gimple_location (info.loads[0]);
+
+  /* NELTS is the number of elements tested before the first counted exit
+     is taken and NITER_MIN the number of executions of the latch by then,
+     which is only needed to find out which exit it is.  */
+  tree nelts = NULL_TREE, niter_min = NULL_TREE;
+  for (i = 0; i < niters.length (); ++i)
+    {
+      tree niter = rewrite_to_non_trapping_overflow (niters[i]);
+      niters[i] = force_gimple_operand_gsi (&gsi, niter, true, NULL_TREE,
+					    false, GSI_CONTINUE_LINKING);
+      tree exit_nelts = niters[i];
+      if (i >= found)
+	exit_nelts = fold_build2 (PLUS_EXPR, sizetype, exit_nelts,
+				  size_one_node);
+      if (i == 0)
+	{
+	  nelts = exit_nelts;
+	  niter_min = niters[i];
+	}
+      else
+	{
+	  nelts = fold_build2 (MIN_EXPR, sizetype, nelts, exit_nelts);
+	  niter_min = fold_build2 (MIN_EXPR, sizetype, niter_min, niters[i]);
+	}
+    }
+  nelts = force_gimple_operand_gsi (&gsi, nelts, true, NULL_TREE, false,
+				    GSI_CONTINUE_LINKING);
+  if (niters.length () > 1)
+    niter_min = force_gimple_operand_gsi (&gsi, niter_min, true, NULL_TREE,
+					  false, GSI_CONTINUE_LINKING);
+
+  tree start = force_gimple_operand_gsi (&gsi, info.bases[0], true,
+					 NULL_TREE, false,
+					 GSI_CONTINUE_LINKING);
+  gcall *fn_call;
+  if (info.loads[1])
+    {
+      tree start2 = force_gimple_operand_gsi (&gsi, info.bases[1], true,
+					      NULL_TREE, false,
+					      GSI_CONTINUE_LINKING);
+      tree size = force_gimple_operand_gsi (&gsi,
+					    fold_build2 (MULT_EXPR, sizetype,
+							 nelts,
+							 TYPE_SIZE_UNIT
+							   (elt_type)),
+					    true, NULL_TREE, false,
+					    GSI_CONTINUE_LINKING);
+      fn_call = gimple_build_call (fn, 3, start, start2, size);
+    }
+  else
+    {
+      tree val = force_gimple_operand_gsi (&gsi,
+					   fold_convert (integer_type_node,
+							 info.pattern),
+					   true, NULL_TREE, false,
+					   GSI_CONTINUE_LINKING);
+      fn_call = gimple_build_call (fn, 3, start, val, nelts);
+    }
+  tree res = make_ssa_name (TREE_TYPE (TREE_TYPE (fn)));
+  gimple_call_set_lhs (fn_call, res);
+  gimple_set_location (fn_call, loc);
+  gsi_insert_after (&gsi, fn_call, GSI_CONTINUE_LINKING);
+
+  gcond *cond = gimple_build_cond (NE_EXPR, res,
+				   build_zero_cst (TREE_TYPE (res)),
+				   NULL_TREE, NULL_TREE);
+  gimple_set_location (cond, loc);
+  gsi_insert_after (&gsi, cond, GSI_CONTINUE_LINKING);
+
+  /* Give each exit a block of its own computing the values used after the
+     loop, the exit taken when the element is found first.  When a character
+     is found, the loop was left in the iteration that loaded it.  */
+  auto_vec<basic_block> exit_bbs;
+  for (i = 0; i <= count_exits.length (); ++i)
+    {
+      edge exit = i == 0 ? info.found_exit : count_exits[i - 1];
+      basic_block exit_bb = split_edge (exit);
+      exit_bbs.safe_push (exit_bb);
+      gsi = gsi_last_bb (exit_bb);
+      tree k;
+      if (i != 0)
+	k = niters[i - 1];
+      else if (!info.loads[1])
+	k = fold_convert (sizetype,
+			  fold_build2 (POINTER_DIFF_EXPR, ptrdiff_type_node,
+				       res, fold_convert (TREE_TYPE (res),
+							  start)));
+      else
+	k = nelts;
+      edge e = single_succ_edge (exit_bb);
+      for (gphi_iterator psi = gsi_start_phis (e->dest); !gsi_end_p (psi);
+	   gsi_next (&psi))
+	{
+	  gphi *phi = psi.phi ();
+	  tree arg = PHI_ARG_DEF_FROM_EDGE (phi, e);
+	  if (virtual_operand_p (gimple_phi_result (phi))
+	      || !ssa_defined_in_loop_p (loop, arg))
+	    continue;
+	  tree val = early_exit_value (loop, &info, i == 0, arg, k);
+	  val = rewrite_to_non_trapping_overflow (val);
+	  val = force_gimple_operand_gsi (&gsi, val, true, NULL_TREE,
+					  false, GSI_CONTINUE_LINKING);
+	  SET_PHI_ARG_DEF (phi, e->dest_idx, val);
+	}
+    }
+
+  /* Make the preheader branch to the exit blocks and remove the loop.  */
+  unsigned nbbs = loop->num_nodes;
+  bbs = get_loop_body_in_dom_order (loop);
+  auto_vec<basic_block> bbs_to_fix_dom;
+  for (i = 0; i < nbbs; ++i)
+    {
+      for (gphi_iterator psi = gsi_start_phis (bbs[i]); !gsi_end_p (psi);
+	   gsi_next (&psi))
+	if (virtual_operand_p (gimple_phi_result (psi.phi ())))
+	  mark_virtual_phi_result_for_renaming (psi.phi ());
+      for (basic_block son = first_dom_son (CDI_DOMINATORS, bbs[i]);
+	   son; son = next_dom_son (CDI_DOMINATORS, son))
+	if (!flow_bb_inside_loop_p (loop, son))
+	  bbs_to_fix_dom.safe_push (son);
+    }
+
+  /* When there are several counted exits, the first one taken is the one
+     with the fewest iterations tested first: when the element is not
+     found, test in turn whether each of them has NITER_MIN iterations.  */
+  profile_count count = profile_count::zero ();
+  for (basic_block exit_bb : exit_bbs)
+    count += exit_bb->count;
+  basic_block cond_bb = preheader;
+  profile_probability prob = profile_probability::always ();
+  auto_vec<edge> new_exits;
+  for (i = 0; i < exit_bbs.length (); ++i)
+    {
+      edge e = single_pred_edge (exit_bbs[i]);
+      redirect_edge_pred (e, cond_bb);
+      new_exits.safe_push (e);
+      e->flags &= ~(EDGE_TRUE_VALUE | EDGE_FALSE_VALUE | EDGE_FALLTHRU);
+      if (i == exit_bbs.length () - 1)
+	{
+	  e->flags |= EDGE_FALSE_VALUE;
+	  e->probability = prob.invert ();
+	  break;
+	}
+
+      e->flags |= EDGE_TRUE_VALUE;
+      prob = exit_bbs[i]->count.probability_in (count);
+      e->probability = prob;
+      count -= exit_bbs[i]->count;
+      if (i + 2 == exit_bbs.length ())
+	continue;
+
+      basic_block next_bb = create_empty_bb (cond_bb);
+      add_bb_to_loop (next_bb, cond_bb->loop_father);
+      next_bb->count = count;
+      edge next_e = make_edge (cond_bb, next_bb, EDGE_FALSE_VALUE);
+      next_e->probability = prob.invert ();
+      set_immediate_dominator (CDI_DOMINATORS, next_bb, cond_bb);
+      cond = gimple_build_cond (EQ_EXPR, niters[i], niter_min,
+				NULL_TREE, NULL_TREE);
+      gimple_set_location (cond, loc);
+      gsi = gsi_last_bb (next_bb);
+      gsi_insert_after (&gsi, cond, GSI_NEW_STMT);
+      cond_bb = next_bb;
+    }
+
+  cancel_loop_tree (loop);
+  for (edge e : new_exits)
+    rescan_loop_exit (e, false, true);
+
+  i = nbbs;
+  do
+    {
+      --i;
+      delete_basic_block (bbs[i]);
+    }
+  while (i != 0);
+  free (bbs);
+
+  iterate_fix_dominators (CDI_DOMINATORS, bbs_to_fix_dom, false);
+
+  if (dump_file && (dump_flags & TDF_DETAILS))
+    fprintf (dump_file, "generated %s\n",
+	     info.loads[1] ? "memcmp" : "memchr");
+
+  return true;
+}
+
 /* Given innermost LOOP, return the outermost enclosing loop that forms a
    perfect loop nest.  */
 
@@ -3805,6 +4429,34 @@ loop_distribution::execute (function *fun)
   if (number_of_loops (fun) <= 1)
     return 0;
 
+  /* Loops with several exits are replaced by calls to memchr or memcmp right
+     away, before control dependences or the topological order of basic
+     blocks are computed.  */
+  if (flag_tree_loop_distribute_patterns)
+    {
+      calculate_dominance_info (CDI_DOMINATORS);
+      for (auto loop : loops_list (cfun, LI_ONLY_INNERMOST))
+	{
+	  if (single_exit (loop))
+	    continue;
+
+	  dump_user_location_t loc = find_loop_location (loop);
+	  int num = loop->num;
+	  if (transform_early_exit_loop (loop))
+	    {
+	      changed = true;
+	      if (dump_enabled_p ())
+		dump_printf_loc (MSG_OPTIMIZED_LOCATIONS,
+				 loc, "Loop %d transformed into a builtin.\n",
+				 num);
+	    }
+	}
+
+      /* Cached scalar evolutions may refer to the removed loops.  */
+      if (changed)
+	scev_reset ();
+    }
+
   bb_top_order_init ();
 
   FOR_ALL_BB_FN (bb, fun)
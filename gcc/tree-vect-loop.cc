@@ -33,6 +33,7 @@ along with GCC; see the file COPYING3.  If not see
 #include "ssa.h"
 #include "optabs-tree.h"
 #include "diagnostic-core.h"
+#include "alias.h"
 #include "fold-const.h"
 #include "stor-layout.h"
 #include "cfganal.h"
@@ -55,6 +56,7 @@ along with GCC; see the file COPYING3.  If not see
 #include "vec-perm-indices.h"
 #include "tree-eh.h"
 #include "case-cfn-macros.h"
+#include "builtins.h"
 
 /* Loop Vectorization Pass.
 
@@ -11437,3 +11439,588 @@ vect_rgroup_iv_might_wrap_p (loop_vec_info loop_vinfo, rgroup_controls *rgc)
 
   return false;
 }
+
+/* A loop searching an array for the first element satisfying a condition,
+   see vect_transform_early_break_loop.  */
+
+struct early_break_info
+{
+  /* The exit taken for the element satisfying the condition.  */
+  edge exit;
+
+  /* The load of the elements and the address of the element it loads in
+     the first iteration.  */
+  gassign *load;
+  tree base;
+
+  /* The condition is ELT CODE VALUE for an element ELT, VALUE being loop
+     invariant and of the type of the elements.  */
+  enum tree_code code;
+  tree value;
+};
+
+/* Return true if the statements in BBS, the body of LOOP, have no side
+   effects and if all the values carried from one iteration of LOOP to the
+   next are induction variables.  Push the header PHIs defining them and
+   their evolutions to IVS.  */
+
+static bool
+vect_early_break_body_p (class loop *loop, basic_block *bbs,
+			 vec<std::pair<gphi *, affine_iv> > *ivs)
+{
+  for (gphi_iterator gsi = gsi_start_phis (loop->header); !gsi_end_p (gsi);
+       gsi_next (&gsi))
+    {
+      tree res = gimple_phi_result (gsi.phi ());
+      if (virtual_operand_p (res))
+	continue;
+
+      affine_iv iv;
+      if ((!INTEGRAL_TYPE_P (TREE_TYPE (res))
+	   && !POINTER_TYPE_P (TREE_TYPE (res)))
+	  || !simple_iv (loop, loop, res, &iv, false))
+	return false;
+      ivs->safe_push (std::make_pair (gsi.phi (), iv));
+    }
+
+  for (unsigned i = 0; i < loop->num_nodes; ++i)
+    for (gimple_stmt_iterator gsi = gsi_start_bb (bbs[i]); !gsi_end_p (gsi);
+	 gsi_next (&gsi))
+      {
+	gimple *stmt = gsi_stmt (gsi);
+	if (is_gimple_debug (stmt) || gimple_code (stmt) == GIMPLE_LABEL)
+	  continue;
+	if (is_gimple_call (stmt)
+	    || gimple_code (stmt) == GIMPLE_ASM
+	    || gimple_vdef (stmt)
+	    || gimple_has_side_effects (stmt)
+	    || gimple_has_volatile_ops (stmt))
+	  return false;
+      }
+
+  return true;
+}
+
+/* Return true if LOOP is left through E when the element loaded in the
+   current iteration compares in a given way with a loop invariant value,
+   consecutive iterations loading consecutive elements.  Fill in INFO
+   accordingly.  */
+
+static bool
+vect_analyze_early_break_cond (class loop *loop, edge e,
+			       early_break_info *info)
+{
+  gcond *cond = safe_dyn_cast <gcond *> (last_stmt (e->src));
+  if (!cond)
+    return false;
+
+  enum tree_code code = gimple_cond_code (cond);
+  tree lhs = gimple_cond_lhs (cond);
+  tree rhs = gimple_cond_rhs (cond);
+  if (!expr_invariant_in_loop_p (loop, rhs))
+    {
+      std::swap (lhs, rhs);
+      code = swap_tree_comparison (code);
+    }
+  if (TREE_CODE (lhs) != SSA_NAME
+      || !INTEGRAL_TYPE_P (TREE_TYPE (lhs))
+      || !expr_invariant_in_loop_p (loop, rhs))
+    return false;
+  if (!(e->flags & EDGE_TRUE_VALUE))
+    code = invert_tree_comparison (code, false);
+
+  /* The element may have been converted for the comparison with a
+     constant.  */
+  tree var = lhs;
+  gassign *def = dyn_cast <gassign *> (SSA_NAME_DEF_STMT (lhs));
+  if (def
+      && CONVERT_EXPR_CODE_P (gimple_assign_rhs_code (def))
+      && TREE_CODE (gimple_assign_rhs1 (def)) == SSA_NAME
+      && TREE_CODE (rhs) == INTEGER_CST)
+    {
+      var = gimple_assign_rhs1 (def);
+      def = dyn_cast <gassign *> (SSA_NAME_DEF_STMT (var));
+    }
+  if (!def
+      || !gimple_assign_load_p (def)
+      || !flow_bb_inside_loop_p (loop, gimple_bb (def)))
+    return false;
+
+  tree ref = gimple_assign_rhs1 (def);
+  tree type = TREE_TYPE (var);
+  if (!INTEGRAL_TYPE_P (type)
+      || !type_has_mode_precision_p (type)
+      || TREE_CODE (ref) == BIT_FIELD_REF
+      || contains_bitfld_component_ref_p (ref)
+      || get_object_alignment (ref) < TYPE_PRECISION (type))
+    return false;
+
+  /* The comparison can be done on the element itself if the conversion
+     preserves the order of the elements, or at least tells them apart for
+     equality comparisons.  */
+  if (var != lhs)
+    {
+      tree lhs_type = TREE_TYPE (lhs);
+      if (TYPE_PRECISION (lhs_type) < TYPE_PRECISION (type)
+	  || !int_fits_type_p (rhs, type))
+	return false;
+      if (TYPE_UNSIGNED (lhs_type) != TYPE_UNSIGNED (type)
+	  && (!TYPE_UNSIGNED (type)
+	      || TYPE_PRECISION (lhs_type) == TYPE_PRECISION (type))
+	  && code != EQ_EXPR
+	  && code != NE_EXPR)
+	return false;
+    }
+
+  affine_iv iv;
+  if (!simple_iv (loop, loop, build_fold_addr_expr (ref), &iv, false)
+      || !operand_equal_p (iv.step, TYPE_SIZE_UNIT (type), 0))
+    return false;
+
+  info->exit = e;
+  info->load = def;
+  info->base = iv.base;
+  info->code = code;
+  info->value = fold_convert (type, rhs);
+  return true;
+}
+
+/* Return the value of the induction variable of type TYPE described by IV
+   after K iterations.  */
+
+static tree
+vect_early_break_iv_value (tree type, const affine_iv &iv, tree k)
+{
+  if (POINTER_TYPE_P (type))
+    return fold_build_pointer_plus (iv.base,
+				    fold_build2 (MULT_EXPR, sizetype, k,
+						 fold_convert (sizetype,
+							       iv.step)));
+
+  /* Compute the value in an unsigned type to avoid introducing undefined
+     overflow.  */
+  tree utype = unsigned_type_for (type);
+  tree val = fold_build2 (MULT_EXPR, utype, fold_convert (utype, k),
+			  fold_convert (utype, iv.step));
+  val = fold_build2 (PLUS_EXPR, utype, fold_convert (utype, iv.base), val);
+  return fold_convert (type, val);
+}
+
+/* Vectorize LOOP, which has several exits, if it searches an array for the
+   first element satisfying a condition, as in
+
+     for (i = 0; i < n; ++i)
+       if (a[i] == x)
+	 break;
+
+   LOOP must have no side effects, and its exits other than the one testing
+   the elements must be counted.  A vector loop is placed before LOOP which
+   tests whole vectors of elements with a vector comparison and a branch on
+   the resulting mask.  It stops at the first vector holding an element
+   satisfying the condition, or when less than a vector of elements is left
+   before the first counted exit is taken.  LOOP is then entered at the
+   first element not known to fail the condition, its induction variables
+   being advanced accordingly, so that it finds that element and computes
+   the values used after it as before.
+
+   The vector loads are aligned and each of them holds an element that LOOP
+   would load, so they do not access another page than LOOP.  The first one
+   may start before the first element: the lanes before it are masked out,
+   but the sanitizers would still report the access, so LOOP is left alone
+   when they instrument the function.  Unless the cost model is unlimited,
+   the vector loop is only used when its costs are below those of LOOP, and
+   only entered when enough elements are left to recover its setup.
+   Return true if LOOP was vectorized.  */
+
+bool
+vect_transform_early_break_loop (class loop *loop)
+{
+  if (loop->inner
+      || loop_cost_model (loop) == VECT_COST_MODEL_VERY_CHEAP
+      || (flag_sanitize
+	  & (SANITIZE_ADDRESS | SANITIZE_KERNEL_ADDRESS | SANITIZE_HWADDRESS))
+      || EDGE_COUNT (loop->header->preds) != 2)
+    return false;
+
+  auto_vec<edge> exits = get_loop_exit_edges (loop);
+  if (exits.length () < 2)
+    return false;
+  for (edge e : exits)
+    if ((e->flags & EDGE_COMPLEX)
+	|| !dominated_by_p (CDI_DOMINATORS, loop->latch, e->src))
+      return false;
+
+  auto_vec<std::pair<gphi *, affine_iv> > ivs;
+  basic_block *bbs = get_loop_body (loop);
+  bool body_ok_p = vect_early_break_body_p (loop, bbs, &ivs);
+  free (bbs);
+  if (!body_ok_p)
+    return false;
+
+  early_break_info info;
+  unsigned i, found;
+  for (found = 0; found < exits.length (); ++found)
+    if (vect_analyze_early_break_cond (loop, exits[found], &info))
+      break;
+  if (found == exits.length ())
+    return false;
+
+  /* Compute the number of executions of the latch before each of the other
+     exits is taken, assuming it is the only one.  The elements loaded in
+     the iterations before the first of them are the ones the vector loop
+     may test.  */
+  auto_vec<tree> niters;
+  for (i = 0; i < exits.length (); ++i)
+    {
+      if (i == found)
+	continue;
+
+      class tree_niter_desc niter_desc;
+      if (!number_of_iterations_exit (loop, exits[i], &niter_desc, false, true)
+	  || !wi::ltu_p (niter_desc.max,
+			 wi::to_widest (TYPE_MAX_VALUE (sizetype))))
+	return false;
+
+      tree niter = fold_convert (sizetype, niter_desc.niter);
+      if (!integer_zerop (niter_desc.may_be_zero))
+	niter = fold_build3 (COND_EXPR, sizetype, niter_desc.may_be_zero,
+			     size_zero_node, niter);
+      niters.safe_push (niter);
+    }
+
+  /* The vector loads use the memory state LOOP is entered with.  */
+  tree vuse = gimple_vuse (info.load);
+  gimple *vuse_def = SSA_NAME_DEF_STMT (vuse);
+  if (gimple_bb (vuse_def)
+      && flow_bb_inside_loop_p (loop, gimple_bb (vuse_def)))
+    {
+      gphi *vphi = dyn_cast <gphi *> (vuse_def);
+      if (!vphi || gimple_bb (vphi) != loop->header)
+	return false;
+      vuse = PHI_ARG_DEF_FROM_EDGE (vphi, loop_preheader_edge (loop));
+    }
+
+  tree elt_type = TREE_TYPE (gimple_assign_lhs (info.load));
+  tree vectype = get_related_vectype_for_scalar_type (VOIDmode, elt_type);
+  unsigned HOST_WIDE_INT nunits;
+  if (!vectype
+      || !TYPE_VECTOR_SUBPARTS (vectype).is_constant (&nunits)
+      || nunits < 2
+      || !pow2p_hwi (nunits))
+    return false;
+
+  tree mask_type = truth_type_for (vectype);
+  tree lane_type = unsigned_type_for (vectype);
+  if (!lane_type
+      || TYPE_MODE (lane_type) != TYPE_MODE (vectype)
+      || !expand_vec_cmp_expr_p (vectype, mask_type, info.code)
+      || !expand_vec_cmp_expr_p (lane_type, mask_type, GE_EXPR)
+      || !target_supports_op_p (mask_type, BIT_AND_EXPR)
+      || (optab_handler (cbranch_optab, TYPE_MODE (mask_type))
+	  == CODE_FOR_nothing))
+    {
+      if (dump_enabled_p ())
+	dump_printf_loc (MSG_MISSED_OPTIMIZATION, vect_location,
+			 "not vectorized: early break on a vector comparison"
+			 " not supported.\n");
+      return false;
+    }
+
+  HOST_WIDE_INT max_niter = max_stmt_executions_int (loop);
+  if (max_niter != -1 && (unsigned HOST_WIDE_INT) max_niter < 2 * nunits)
+    {
+      if (dump_enabled_p ())
+	dump_printf_loc (MSG_MISSED_OPTIMIZATION, vect_location,
+			 "not vectorized: iteration count smaller than"
+			 " two vectors.\n");
+      return false;
+    }
+
+  /* Compare the cost of testing NUNITS elements with LOOP and with the
+     vector loop, and compute the minimum number of elements for which the
+     vector loop recovers the cost of its setup.  */
+  unsigned HOST_WIDE_INT th = 0;
+  if (loop_cost_model (loop) != VECT_COST_MODEL_UNLIMITED)
+    {
+      auto cost = [&] (enum vect_cost_for_stmt kind)
+	{
+	  return builtin_vectorization_cost (kind, vectype, 0);
+	};
+      int scalar_cost = (cost (scalar_load)
+			 + exits.length () * (cost (scalar_stmt)
+					      + cost (cond_branch_not_taken))
+			 + ivs.length () * cost (scalar_stmt));
+      int vec_body_cost = (cost (vector_load) + cost (vector_stmt)
+			   + 2 * cost (scalar_stmt) + cost (cond_branch_taken)
+			   + cost (cond_branch_not_taken));
+      int vec_setup_cost = (2 * cost (scalar_to_vec) + cost (vector_load)
+			    + 3 * cost (vector_stmt)
+			    + 2 * cost (cond_branch_not_taken)
+			    + (4 + ivs.length ()) * cost (scalar_stmt));
+      int saving = (int) nunits * scalar_cost - vec_body_cost;
+      if (dump_enabled_p ())
+	{
+	  dump_printf_loc (MSG_NOTE, vect_location,
+			   "Cost model analysis for the early break loop:\n");
+	  dump_printf (MSG_NOTE, "  Scalar iteration cost: %d\n", scalar_cost);
+	  dump_printf (MSG_NOTE, "  Vector inside of loop cost: %d\n",
+		       vec_body_cost);
+	  dump_printf (MSG_NOTE, "  Vector prologue cost: %d\n",
+		       vec_setup_cost);
+	}
+      if (saving <= 0)
+	{
+	  if (dump_enabled_p ())
+	    dump_printf_loc (MSG_MISSED_OPTIMIZATION, vect_location,
+			     "not vectorized: vectorization not"
+			     " profitable.\n");
+	  return false;
+	}
+      th = vec_setup_cost * nunits / saving + 1;
+      th = MAX (th, (unsigned HOST_WIDE_INT) param_min_vect_loop_bound
+		    * nunits);
+      if (dump_enabled_p ())
+	dump_printf (MSG_NOTE, "  Runtime profitability threshold = %wu\n",
+		     th);
+
+      HOST_WIDE_INT est_niter = estimated_stmt_executions_int (loop);
+      if (est_niter != -1 && (unsigned HOST_WIDE_INT) est_niter < th)
+	{
+	  if (dump_enabled_p ())
+	    dump_printf_loc (MSG_MISSED_OPTIMIZATION, vect_location,
+			     "not vectorized: estimated iteration count"
+			     " smaller than the profitability threshold.\n");
+	  return false;
+	}
+    }
+
+  unsigned HOST_WIDE_INT elt_size = tree_to_uhwi (TYPE_SIZE_UNIT (elt_type));
+  unsigned HOST_WIDE_INT vec_size = nunits * elt_size;
+  if (dump_enabled_p ())
+    dump_printf_loc (MSG_OPTIMIZED_LOCATIONS, vect_location,
+		     "loop with an early break vectorized using %wu byte"
+		     " vectors\n", vec_size);
+
+  tree access_type = vectype;
+  if (TYPE_ALIGN_UNIT (vectype) != vec_size)
+    access_type = build_aligned_type (vectype, vec_size * BITS_PER_UNIT);
+  tree alias_ptr_type
+    = reference_alias_ptr_type (gimple_assign_rhs1 (info.load));
+  location_t loc = gimple_location (info.load);
+  class loop *outer = loop_outer (loop);
+
+  /* JOIN_BB enters LOOP at the element the vector loop placed between
+     SETUP_BB and JOIN_BB stops at.  */
+  basic_block join_bb = split_edge (loop_preheader_edge (loop));
+  basic_block setup_bb = split_edge (single_pred_edge (join_bb));
+  edge setup_skip_e = single_succ_edge (setup_bb);
+
+  /* LIMIT is the number of elements before the first counted exit is
+     taken and MIS the number of lanes before the first element in the
+     vector holding it.  The vector loop is only entered if that vector
+     fits below LIMIT and LIMIT reaches the profitability threshold.  */
+  gimple_seq seq = NULL, stmts;
+  tree limit = NULL_TREE;
+  for (tree niter : niters)
+    {
+      niter = force_gimple_operand (rewrite_to_non_trapping_overflow (niter),
+				    &stmts, true, NULL_TREE);
+      gimple_seq_add_seq (&seq, stmts);
+      limit = limit ? gimple_build (&seq, MIN_EXPR, sizetype, limit, niter)
+		    : niter;
+    }
+  tree base = force_gimple_operand (unshare_expr (info.base), &stmts, true,
+				    NULL_TREE);
+  gimple_seq_add_seq (&seq, stmts);
+  tree ptr_type = TREE_TYPE (base);
+  tree mis_bytes = gimple_build (&seq, BIT_AND_EXPR, sizetype,
+				 gimple_convert (&seq, sizetype, base),
+				 size_int (vec_size - 1));
+  tree mis = gimple_build (&seq, EXACT_DIV_EXPR, sizetype, mis_bytes,
+			   size_int (elt_size));
+  tree first = gimple_build (&seq, MINUS_EXPR, sizetype, size_int (nunits),
+			     mis);
+  tree value = force_gimple_operand (unshare_expr (info.value), &stmts, true,
+				     NULL_TREE);
+  gimple_seq_add_seq (&seq, stmts);
+  value = gimple_build_vector_from_val (&seq, vectype,
+					gimple_convert (&seq, elt_type,
+							value));
+  tree lane_mis
+    = gimple_build_vector_from_val (&seq, lane_type,
+				    gimple_convert (&seq,
+						    TREE_TYPE (lane_type),
+						    mis));
+  tree bound = first;
+  if (th > nunits)
+    bound = gimple_build (&seq, MAX_EXPR, sizetype, first, size_int (th));
+  gimple_stmt_iterator gsi = gsi_last_bb (setup_bb);
+  gsi_insert_seq_after (&gsi, seq, GSI_CONTINUE_LINKING);
+  gcond *cond = gimple_build_cond (GE_EXPR, limit, bound, NULL_TREE,
+				   NULL_TREE);
+  gimple_set_location (cond, loc);
+  gsi_insert_after (&gsi, cond, GSI_NEW_STMT);
+
+  /* Emit to VSEQ the load of the vector at ADDR and return the mask of its
+     elements satisfying the condition.  */
+  auto test_vector = [&] (gimple_seq *vseq, tree addr)
+    {
+      if (!is_gimple_mem_ref_addr (addr))
+	{
+	  tree tem = make_ssa_name (ptr_type);
+	  gimple_seq_add_stmt (vseq, gimple_build_assign (tem, addr));
+	  addr = tem;
+	}
+      tree vec = make_ssa_name (vectype);
+      gassign *load
+	= gimple_build_assign (vec, build2 (MEM_REF, access_type, addr,
+					    build_int_cst (alias_ptr_type,
+							   0)));
+      gimple_set_vuse (load, vuse);
+      gimple_set_location (load, loc);
+      gimple_seq_add_stmt (vseq, load);
+      return gimple_build (vseq, info.code, mask_type, vec, value);
+    };
+
+  /* FIRST_BB tests the elements of the first vector, from the first
+     element on.  The loop made of HEAD_BB, BODY_BB and LATCH_BB tests the
+     following vectors as long as they are below LIMIT, SKIP being the first
+     element of the current one.  */
+  basic_block first_bb = create_empty_bb (setup_bb);
+  basic_block head_bb = create_empty_bb (first_bb);
+  basic_block body_bb = create_empty_bb (head_bb);
+  basic_block latch_bb = create_empty_bb (body_bb);
+  basic_block done_bb = create_empty_bb (latch_bb);
+  add_bb_to_loop (first_bb, outer);
+  add_bb_to_loop (head_bb, outer);
+  add_bb_to_loop (body_bb, outer);
+  add_bb_to_loop (latch_bb, outer);
+  add_bb_to_loop (done_bb, outer);
+
+  seq = NULL;
+  tree addr = gimple_build (&seq, POINTER_PLUS_EXPR, ptr_type, base,
+			    gimple_build (&seq, NEGATE_EXPR, sizetype,
+					  mis_bytes));
+  tree mask = test_vector (&seq, addr);
+  tree lanes_mask = gimple_build (&seq, GE_EXPR, mask_type,
+				  build_index_vector (lane_type, 0, 1),
+				  lane_mis);
+  mask = gimple_build (&seq, BIT_AND_EXPR, mask_type, mask, lanes_mask);
+  gsi = gsi_start_bb (first_bb);
+  gsi_insert_seq_after (&gsi, seq, GSI_CONTINUE_LINKING);
+  cond = gimple_build_cond (NE_EXPR, mask, build_zero_cst (mask_type),
+			    NULL_TREE, NULL_TREE);
+  gimple_set_location (cond, loc);
+  gsi_insert_after (&gsi, cond, GSI_NEW_STMT);
+
+  tree skip = make_ssa_name (sizetype);
+  gphi *skip_phi = create_phi_node (skip, head_bb);
+  seq = NULL;
+  tree left = gimple_build (&seq, MINUS_EXPR, sizetype, limit, skip);
+  gsi = gsi_start_bb (head_bb);
+  gsi_insert_seq_after (&gsi, seq, GSI_CONTINUE_LINKING);
+  cond = gimple_build_cond (GE_EXPR, left, size_int (nunits), NULL_TREE,
+			    NULL_TREE);
+  gimple_set_location (cond, loc);
+  gsi_insert_after (&gsi, cond, GSI_NEW_STMT);
+
+  seq = NULL;
+  addr = gimple_build (&seq, POINTER_PLUS_EXPR, ptr_type, base,
+		       gimple_build (&seq, MULT_EXPR, sizetype, skip,
+				     size_int (elt_size)));
+  mask = test_vector (&seq, addr);
+  gsi = gsi_start_bb (body_bb);
+  gsi_insert_seq_after (&gsi, seq, GSI_CONTINUE_LINKING);
+  cond = gimple_build_cond (NE_EXPR, mask, build_zero_cst (mask_type),
+			    NULL_TREE, NULL_TREE);
+  gimple_set_location (cond, loc);
+  gsi_insert_after (&gsi, cond, GSI_NEW_STMT);
+
+  seq = NULL;
+  tree next = gimple_build (&seq, PLUS_EXPR, sizetype, skip,
+			    size_int (nunits));
+  gsi = gsi_start_bb (latch_bb);
+  gsi_insert_seq_after (&gsi, seq, GSI_CONTINUE_LINKING);
+
+  /* The first vector and each of the following ones are expected to fail
+     the condition, until the vector loop has run its expected number of
+     iterations.  */
+  unsigned iters = MAX (expected_loop_iterations (loop) / nunits, 1);
+  profile_probability hit_prob = profile_probability::unlikely ();
+  profile_probability more_prob
+    = profile_probability::always ().apply_scale (iters, iters + 1);
+
+  setup_skip_e->flags &= ~EDGE_FALLTHRU;
+  setup_skip_e->flags |= EDGE_FALSE_VALUE;
+  setup_skip_e->probability = profile_probability::unlikely ();
+  edge e = make_edge (setup_bb, first_bb, EDGE_TRUE_VALUE);
+  e->probability = setup_skip_e->probability.invert ();
+  first_bb->count = e->count ();
+
+  edge first_skip_e = make_edge (first_bb, join_bb, EDGE_TRUE_VALUE);
+  first_skip_e->probability = hit_prob;
+  edge enter_e = make_edge (first_bb, head_bb, EDGE_FALSE_VALUE);
+  enter_e->probability = hit_prob.invert ();
+
+  e = make_edge (head_bb, body_bb, EDGE_TRUE_VALUE);
+  e->probability = more_prob;
+  edge head_done_e = make_edge (head_bb, done_bb, EDGE_FALSE_VALUE);
+  head_done_e->probability = more_prob.invert ();
+  edge body_done_e = make_edge (body_bb, done_bb, EDGE_TRUE_VALUE);
+  body_done_e->probability = hit_prob;
+  e = make_edge (body_bb, latch_bb, EDGE_FALSE_VALUE);
+  e->probability = hit_prob.invert ();
+  edge latch_e = make_edge (latch_bb, head_bb, EDGE_FALLTHRU);
+  latch_e->probability = profile_probability::always ();
+  edge done_skip_e = make_edge (done_bb, join_bb, EDGE_FALLTHRU);
+  done_skip_e->probability = profile_probability::always ();
+
+  done_bb->count = enter_e->count ();
+  head_bb->count = done_bb->count.apply_scale (iters + 1, 1);
+  body_bb->count = done_bb->count.apply_scale (iters, 1);
+  latch_bb->count = body_bb->count;
+
+  add_phi_arg (skip_phi, first, enter_e, UNKNOWN_LOCATION);
+  add_phi_arg (skip_phi, next, latch_e, UNKNOWN_LOCATION);
+  tree done_skip = make_ssa_name (sizetype);
+  gphi *phi = create_phi_node (done_skip, done_bb);
+  add_phi_arg (phi, skip, head_done_e, UNKNOWN_LOCATION);
+  add_phi_arg (phi, skip, body_done_e, UNKNOWN_LOCATION);
+  tree join_skip = make_ssa_name (sizetype);
+  phi = create_phi_node (join_skip, join_bb);
+  add_phi_arg (phi, size_zero_node, setup_skip_e, UNKNOWN_LOCATION);
+  add_phi_arg (phi, size_zero_node, first_skip_e, UNKNOWN_LOCATION);
+  add_phi_arg (phi, done_skip, done_skip_e, UNKNOWN_LOCATION);
+
+  set_immediate_dominator (CDI_DOMINATORS, first_bb, setup_bb);
+  set_immediate_dominator (CDI_DOMINATORS, head_bb, first_bb);
+  set_immediate_dominator (CDI_DOMINATORS, body_bb, head_bb);
+  set_immediate_dominator (CDI_DOMINATORS, latch_bb, body_bb);
+  set_immediate_dominator (CDI_DOMINATORS, done_bb, head_bb);
+
+  class loop *scan_loop = alloc_loop ();
+  scan_loop->header = head_bb;
+  scan_loop->latch = latch_bb;
+  add_loop (scan_loop, outer);
+  split_edge (enter_e);
+
+  /* Enter LOOP at the element JOIN_SKIP.  */
+  edge preheader_e = loop_preheader_edge (loop);
+  seq = NULL;
+  for (auto iv : ivs)
+    {
+      tree type = TREE_TYPE (gimple_phi_result (iv.first));
+      tree val = vect_early_break_iv_value (type, iv.second, join_skip);
+      val = force_gimple_operand (rewrite_to_non_trapping_overflow (val),
+				  &stmts, true, NULL_TREE);
+      gimple_seq_add_seq (&seq, stmts);
+      SET_PHI_ARG_DEF (iv.first, preheader_e->dest_idx, val);
+    }
+  gsi = gsi_start_bb (join_bb);
+  gsi_insert_seq_after (&gsi, seq, GSI_CONTINUE_LINKING);
+
+  /* The cached evolutions of the induction variables of LOOP refer to their
+     former initial values.  */
+  scev_reset_htab ();
+  return true;
+}
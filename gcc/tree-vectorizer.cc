@@ -1078,6 +1078,18 @@ try_vectorize_loop_1 (hash_table<simduid_to_vf> *&simduid_to_vf_htab,
 
   if (!loop_vinfo || !LOOP_VINFO_VECTORIZABLE_P (loop_vinfo))
     {
+      /* Loops with several exits are rejected by the analysis, but those
+	 searching an array can still be scanned with vectors.  */
+      if (!loop_vinfo
+	  && !loop_vectorized_call
+	  && !single_exit (loop)
+	  && dbg_cnt (vect_loop)
+	  && vect_transform_early_break_loop (loop))
+	{
+	  (*num_vectorized_loops)++;
+	  return ret | TODO_cleanup_cfg;
+	}
+
       /* Free existing information if loop is analyzed with some
 	 assumptions.  */
       if (loop_constraint_set_p (loop, LOOP_C_FINITE))
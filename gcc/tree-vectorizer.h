@@ -2301,6 +2301,7 @@ extern bool reduction_fn_for_scalar_code (code_helper, internal_fn *);
 
 /* Drive for loop transformation stage.  */
 extern class loop *vect_transform_loop (loop_vec_info, gimple *);
+extern bool vect_transform_early_break_loop (class loop *);
 struct vect_loop_form_info
 {
   tree number_of_iterations;
@@ -52,4 +52,19 @@ protect_end (void *ptr, UWORD dummy UNUSED)
 # endif
 #endif /* protect_start_end */
 
+/* The posix libat_lock_n maintains a sequence count per lock, so that
+   large loads can proceed without taking the locks.  */
+#ifndef HAVE_SEQLOCK_N
+# ifdef HAVE_ATTRIBUTE_VISIBILITY
+#  pragma GCC visibility push(hidden)
+# endif
+
+void libat_seqlock_load_n (void *mptr, void *rptr, size_t n);
+
+# define HAVE_SEQLOCK_N 1
+# ifdef HAVE_ATTRIBUTE_VISIBILITY
+#  pragma GCC visibility pop
+# endif
+#endif /* HAVE_SEQLOCK_N */
+
 #include_next <host-config.h>
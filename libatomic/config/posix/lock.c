@@ -45,11 +45,23 @@
 #define WATCH_SIZE	CACHLINE_SIZE
 #endif
 
+/* The number of optimistic attempts a large load makes before it gives
+   up and takes the locks itself.  Bounding this keeps readers from
+   starving when writers hammer the same locks.  */
+#ifndef SEQLOCK_TRIES
+#define SEQLOCK_TRIES	16
+#endif
+
+/* Each lock carries a sequence count alongside the mutex.  It is odd
+   while a libat_lock_n holder may be modifying memory covered by the
+   lock, and is advanced again before the mutex is released.  This lets
+   libat_seqlock_load_n copy an object without writing shared state.  */
 struct lock
 {
   pthread_mutex_t mutex;
-  char pad[sizeof(pthread_mutex_t) < CACHLINE_SIZE
-	   ? CACHLINE_SIZE - sizeof(pthread_mutex_t)
+  unsigned long seq;
+  char pad[sizeof(pthread_mutex_t) + sizeof(unsigned long) < CACHLINE_SIZE
+	   ? CACHLINE_SIZE - sizeof(pthread_mutex_t) - sizeof(unsigned long)
 	   : 0];
 };
 
@@ -89,11 +101,15 @@ libat_lock_n (void *ptr, size_t n)
   do
     {
       pthread_mutex_lock (&locks[h].mutex);
+      __atomic_store_n (&locks[h].seq, locks[h].seq + 1, __ATOMIC_RELAXED);
       if (++h == NLOCKS)
 	h = 0;
       i += WATCH_SIZE;
     }
   while (i < n);
+
+  /* Order the odd sequence counts before the caller's stores.  */
+  __atomic_thread_fence (__ATOMIC_RELEASE);
 }
 
 void
@@ -107,6 +123,7 @@ libat_unlock_n (void *ptr, size_t n)
 
   do
     {
+      __atomic_store_n (&locks[h].seq, locks[h].seq + 1, __ATOMIC_RELEASE);
       pthread_mutex_unlock (&locks[h].mutex);
       if (++h == NLOCKS)
 	h = 0;
@@ -114,3 +131,63 @@ libat_unlock_n (void *ptr, size_t n)
     }
   while (i < n);
 }
+
+/* Sum the sequence counts of the locks covering N bytes at PTR, or
+   return an odd value if any of them is held by a writer.  The counts
+   only ever increase, so two equal sums imply that no individual count
+   changed in between.  */
+
+static inline unsigned long
+seq_sum (uintptr_t h, size_t n, int model)
+{
+  unsigned long sum = 0;
+  size_t i = 0;
+
+  do
+    {
+      unsigned long s = __atomic_load_n (&locks[h].seq, model);
+      if (s & 1)
+	return 1;
+      sum += s;
+      if (++h == NLOCKS)
+	h = 0;
+      i += WATCH_SIZE;
+    }
+  while (i < n);
+
+  return sum;
+}
+
+void
+libat_seqlock_load_n (void *mptr, void *rptr, size_t n)
+{
+  uintptr_t h = addr_hash (mptr);
+  size_t ln = n > PAGE_SIZE ? PAGE_SIZE : n;
+  size_t i;
+  int tries;
+
+  for (tries = 0; tries < SEQLOCK_TRIES; ++tries)
+    {
+      unsigned long s0 = seq_sum (h, ln, __ATOMIC_ACQUIRE);
+      if (s0 & 1)
+	continue;
+
+      /* The copy may race with a writer; the result is discarded
+	 in that case, which the re-check of the counts detects.  */
+      memcpy (rptr, mptr, n);
+
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+      if (seq_sum (h, ln, __ATOMIC_RELAXED) == s0)
+	return;
+    }
+
+  /* Too much write traffic.  Take the mutexes, but leave the sequence
+     counts alone so as not to disturb other optimistic readers.  */
+  for (i = 0; i == 0 || i < ln; i += WATCH_SIZE)
+    pthread_mutex_lock (&locks[(h + i / WATCH_SIZE) % NLOCKS].mutex);
+
+  memcpy (rptr, mptr, n);
+
+  for (i = 0; i == 0 || i < ln; i += WATCH_SIZE)
+    pthread_mutex_unlock (&locks[(h + i / WATCH_SIZE) % NLOCKS].mutex);
+}
@@ -89,11 +89,15 @@ libat_load (size_t n, void *mptr, void *rptr, int smodel)
     }
 
   pre_seq_barrier (smodel);
+#ifdef HAVE_SEQLOCK_N
+  libat_seqlock_load_n (mptr, rptr, n);
+#else
   libat_lock_n (mptr, n);
 
   memcpy (rptr, mptr, n);
 
   libat_unlock_n (mptr, n);
+#endif
   post_seq_barrier (smodel);
 }
 
@@ -158,6 +158,13 @@ void protect_end (void *ptr, UWORD);
 void libat_lock_n (void *ptr, size_t n);
 void libat_unlock_n (void *ptr, size_t n);
 
+/* Copying for a "large" load.  Targets whose libat_lock_n also bumps a
+   sequence count may define HAVE_SEQLOCK_N in <host-config.h> and
+   provide a reader that retries optimistically instead of locking.
+
+void libat_seqlock_load_n (void *mptr, void *rptr, size_t n);
+*/
+
 /* We'll need to declare all of the sized functions a few times...  */
 #define DECLARE_ALL_SIZED(N)  DECLARE_ALL_SIZED_(N,C2(U_,N))
 #define DECLARE_ALL_SIZED_(N,T)						\
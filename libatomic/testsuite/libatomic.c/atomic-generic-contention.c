@@ -0,0 +1,97 @@
+/* Test that generic __atomic_load never observes a torn object while
+   other threads store to it, and report the read throughput.  */
+/* { dg-do run } */
+/* { dg-require-effective-target pthread } */
+/* { dg-options "-pthread -w" } */
+
+/* The large loads are served by the sequence-count fallback of the
+   locking implementation.  Readers must see each object either wholly
+   before or wholly after a store.  Run with an argument to print the
+   number of loads completed per thread, which gives a rough contention
+   benchmark for reader-heavy use.  */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+extern void abort (void);
+
+#define NWORDS 24
+#define NREADERS 4
+#define NWRITERS 1
+#define SECONDS 1
+
+typedef struct big {
+  unsigned long w[NWORDS];
+} big_struct;
+
+static big_struct shared;
+static volatile int stop;
+static unsigned long loads[NREADERS];
+
+static void *
+reader (void *arg)
+{
+  unsigned long *count = arg;
+  big_struct b;
+  int i;
+
+  while (!stop)
+    {
+      __atomic_load (&shared, &b, __ATOMIC_ACQUIRE);
+      for (i = 1; i < NWORDS; i++)
+	if (b.w[i] != b.w[0])
+	  abort ();
+      ++*count;
+    }
+  return NULL;
+}
+
+static void *
+writer (void *arg)
+{
+  unsigned long v = (unsigned long) arg;
+  big_struct b;
+  int i;
+
+  while (!stop)
+    {
+      v += NWRITERS;
+      for (i = 0; i < NWORDS; i++)
+	b.w[i] = v;
+      __atomic_store (&shared, &b, __ATOMIC_RELEASE);
+    }
+  return NULL;
+}
+
+int
+main (int argc, char **argv)
+{
+  pthread_t r[NREADERS], w[NWRITERS];
+  unsigned long total = 0;
+  int i;
+
+  for (i = 0; i < NREADERS; i++)
+    if (pthread_create (&r[i], NULL, reader, &loads[i]))
+      return 0;
+  for (i = 0; i < NWRITERS; i++)
+    if (pthread_create (&w[i], NULL, writer, (void *) (unsigned long) i))
+      return 0;
+
+  sleep (SECONDS);
+  stop = 1;
+
+  for (i = 0; i < NWRITERS; i++)
+    pthread_join (w[i], NULL);
+  for (i = 0; i < NREADERS; i++)
+    {
+      pthread_join (r[i], NULL);
+      total += loads[i];
+    }
+
+  if (argc > 1)
+    printf ("%lu loads/s per reader\n", total / NREADERS / SECONDS);
+
+  return 0;
+}
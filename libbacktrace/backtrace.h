@@ -173,6 +173,19 @@ extern int backtrace_pcinfo (struct backtrace_state *state, uintptr_t pc,
 			     backtrace_error_callback error_callback,
 			     void *data);
 
+/* Like backtrace_pcinfo, but for each of the COUNT program counters in
+   PCS in turn.  The PCS should be sorted in ascending order; that is
+   not required, but neighbouring PCs then share most of the work of
+   looking them up, which makes symbolizing many PCs much faster than
+   calling backtrace_pcinfo for each.  This stops at and returns the
+   first non-zero value returned by CALLBACK, or returns 0.  */
+
+extern int backtrace_pcinfo_batch (struct backtrace_state *state,
+				   const uintptr_t *pcs, size_t count,
+				   backtrace_full_callback callback,
+				   backtrace_error_callback error_callback,
+				   void *data);
+
 /* The type of the callback argument to backtrace_syminfo.  DATA and
    PC are the arguments passed to backtrace_syminfo.  SYMNAME is the
    name of the symbol for the corresponding code.  SYMVAL is the
@@ -459,6 +459,136 @@ test5 (void)
   return failures;
 }
 
+/* Test that backtrace_pcinfo_batch reports the same information as
+   calling backtrace_pcinfo for each PC.  */
+
+static int test6 (void) __attribute__ ((noinline, noclone, unused));
+static int f62 (int) __attribute__ ((noinline, noclone));
+static int f63 (int, int) __attribute__ ((noinline, noclone));
+
+static int
+test6 (void)
+{
+  return f62 (__LINE__) + 1;
+}
+
+static int
+f62 (int f1line)
+{
+  return f63 (f1line, __LINE__) + 2;
+}
+
+static int
+uintptr_compare (const void *p1, const void *p2)
+{
+  uintptr_t a1 = *(const uintptr_t *) p1;
+  uintptr_t a2 = *(const uintptr_t *) p2;
+
+  return a1 < a2 ? -1 : a1 > a2 ? 1 : 0;
+}
+
+static int
+f63 (int f1line ATTRIBUTE_UNUSED, int f2line ATTRIBUTE_UNUSED)
+{
+  uintptr_t addrs[20];
+  struct sdata data;
+  struct info all1[20];
+  struct info all2[20];
+  struct bdata bdata1;
+  struct bdata bdata2;
+  size_t j;
+  int i;
+
+  data.addrs = &addrs[0];
+  data.index = 0;
+  data.max = 20;
+  data.failed = 0;
+
+  i = backtrace_simple (state, 0, callback_two, error_callback_two, &data);
+  if (i != 0)
+    {
+      fprintf (stderr, "test6: unexpected return value %d\n", i);
+      data.failed = 1;
+    }
+
+  if (!data.failed && data.index < 3)
+    {
+      fprintf (stderr,
+	       "test6: not enough frames; got %zu, expected at least 3\n",
+	       data.index);
+      data.failed = 1;
+    }
+
+  if (!data.failed)
+    {
+      /* Look up the frames of this test twice each, in ascending
+	 order.  */
+      for (j = 0; j < 3; ++j)
+	addrs[j + 3] = addrs[j];
+      qsort (addrs, 6, sizeof addrs[0], uintptr_compare);
+
+      bdata1.all = &all1[0];
+      bdata1.index = 0;
+      bdata1.max = 20;
+      bdata1.failed = 0;
+
+      for (j = 0; j < 6; ++j)
+	backtrace_pcinfo (state, addrs[j], callback_one, error_callback_one,
+			  &bdata1);
+
+      bdata2.all = &all2[0];
+      bdata2.index = 0;
+      bdata2.max = 20;
+      bdata2.failed = 0;
+
+      i = backtrace_pcinfo_batch (state, addrs, 6, callback_one,
+				  error_callback_one, &bdata2);
+      if (i != 0)
+	{
+	  fprintf (stderr,
+		   ("test6: unexpected return value "
+		    "from backtrace_pcinfo_batch %d\n"),
+		   i);
+	  data.failed = 1;
+	}
+
+      if (bdata1.failed || bdata2.failed)
+	data.failed = 1;
+      else if (bdata1.index != bdata2.index)
+	{
+	  fprintf (stderr,
+		   ("test6: wrong number of calls from backtrace_pcinfo_batch "
+		    "got %u expected %u\n"),
+		   (unsigned int) bdata2.index, (unsigned int) bdata1.index);
+	  data.failed = 1;
+	}
+      else
+	{
+	  for (j = 0; j < bdata1.index; ++j)
+	    {
+	      if (all1[j].lineno != all2[j].lineno
+		  || (all1[j].filename == NULL) != (all2[j].filename == NULL)
+		  || (all1[j].filename != NULL
+		      && strcmp (all1[j].filename, all2[j].filename) != 0)
+		  || (all1[j].function == NULL) != (all2[j].function == NULL)
+		  || (all1[j].function != NULL
+		      && strcmp (all1[j].function, all2[j].function) != 0))
+		{
+		  fprintf (stderr, "test6: [%u]: mismatch\n", (unsigned int) j);
+		  data.failed = 1;
+		}
+	    }
+	}
+    }
+
+  printf ("%s: backtrace_pcinfo_batch\n", data.failed ? "FAIL" : "PASS");
+
+  if (data.failed)
+    ++failures;
+
+  return failures;
+}
+
 #define MIN_DESCRIPTOR 3
 #define MAX_DESCRIPTOR 10
 
@@ -509,6 +639,7 @@ main (int argc ATTRIBUTE_UNUSED, char **argv)
 #if BACKTRACE_SUPPORTS_DATA
   test5 ();
 #endif
+  test6 ();
 #endif
 
   check_open_files ();
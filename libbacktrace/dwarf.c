@@ -407,6 +407,23 @@ struct dwarf_data
   struct function_vector fvec;
 };
 
+/* The results of the previous lookup in one module, used as a starting
+   point when looking up PC values in ascending order.  */
+
+struct dwarf_pc_cursor
+{
+  /* The module searched.  */
+  struct dwarf_data *ddata;
+  /* The entry of DDATA->addrs found by the binary search.  */
+  struct unit_addrs *entry;
+  /* The unit whose line and function tables were searched.  */
+  struct unit *u;
+  /* The entry of U->lines found.  */
+  struct line *ln;
+  /* The entry of U->function_addrs found.  */
+  struct function_addrs *fn;
+};
+
 /* Report an error for a DWARF buffer.  */
 
 static void
@@ -3633,16 +3650,45 @@ report_inlined_functions (uintptr_t pc, struct function *function,
   return 0;
 }
 
+/* Like bsearch, but if HINT is not NULL it is the element of BASE that
+   a search for a key no larger than KEY returned.  Only the elements
+   from HINT onward need be searched then, and usually KEY matches HINT
+   itself.  */
+
+static void *
+bsearch_from (const void *key, const void *base, size_t nmemb, size_t size,
+	      int (*compar) (const void *, const void *), void *hint)
+{
+  if (hint != NULL)
+    {
+      int cmp;
+
+      cmp = compar (key, hint);
+      if (cmp == 0)
+	return hint;
+      if (cmp > 0)
+	{
+	  size_t skip;
+
+	  skip = ((const char *) hint - (const char *) base) / size + 1;
+	  base = (const char *) hint + size;
+	  nmemb -= skip;
+	}
+    }
+  return bsearch (key, base, nmemb, size, compar);
+}
+
 /* Look for a PC in the DWARF mapping for one module.  On success,
    call CALLBACK and return whatever it returns.  On error, call
    ERROR_CALLBACK and return 0.  Sets *FOUND to 1 if the PC is found,
-   0 if not.  */
+   0 if not.  If CURSOR is not NULL, it holds the results of looking up
+   a PC no larger than this one, and is updated for the next lookup.  */
 
 static int
 dwarf_lookup_pc (struct backtrace_state *state, struct dwarf_data *ddata,
 		 uintptr_t pc, backtrace_full_callback callback,
 		 backtrace_error_callback error_callback, void *data,
-		 int *found)
+		 int *found, struct dwarf_pc_cursor *cursor)
 {
   struct unit_addrs *entry;
   int found_entry;
@@ -3662,10 +3708,17 @@ dwarf_lookup_pc (struct backtrace_state *state, struct dwarf_data *ddata,
   /* Find an address range that includes PC.  Our search isn't safe if
      PC == -1, as we use that as a sentinel value, so skip the search
      in that case.  */
+  if (cursor != NULL && cursor->ddata != ddata)
+    {
+      memset (cursor, 0, sizeof *cursor);
+      cursor->ddata = ddata;
+    }
+
   entry = (ddata->addrs_count == 0 || pc + 1 == 0
 	   ? NULL
-	   : bsearch (&pc, ddata->addrs, ddata->addrs_count,
-		      sizeof (struct unit_addrs), unit_addrs_search));
+	   : bsearch_from (&pc, ddata->addrs, ddata->addrs_count,
+			   sizeof (struct unit_addrs), unit_addrs_search,
+			   cursor != NULL ? cursor->entry : NULL));
 
   if (entry == NULL)
     {
@@ -3673,6 +3726,9 @@ dwarf_lookup_pc (struct backtrace_state *state, struct dwarf_data *ddata,
       return 0;
     }
 
+  if (cursor != NULL)
+    cursor->entry = entry;
+
   /* Here pc >= entry->low && pc < (entry + 1)->low.  The unit_addrs
      are sorted by low, so if pc > p->low we are at the end of a range
      of unit_addrs with the same low value.  If pc == p->low walk
@@ -3795,14 +3851,24 @@ dwarf_lookup_pc (struct backtrace_state *state, struct dwarf_data *ddata,
 	 this PC.  */
       if (new_data)
 	return dwarf_lookup_pc (state, ddata, pc, callback, error_callback,
-				data, found);
+				data, found, cursor);
       return callback (data, pc, NULL, 0, NULL);
     }
 
+  if (cursor != NULL && cursor->u != entry->u)
+    {
+      cursor->u = entry->u;
+      cursor->ln = NULL;
+      cursor->fn = NULL;
+    }
+
   /* Search for PC within this unit.  */
 
-  ln = (struct line *) bsearch (&pc, lines, entry->u->lines_count,
-				sizeof (struct line), line_search);
+  ln = (struct line *) bsearch_from (&pc, lines, entry->u->lines_count,
+				     sizeof (struct line), line_search,
+				     cursor != NULL ? cursor->ln : NULL);
+  if (cursor != NULL && ln != NULL)
+    cursor->ln = ln;
   if (ln == NULL)
     {
       /* The PC is between the low_pc and high_pc attributes of the
@@ -3852,13 +3918,17 @@ dwarf_lookup_pc (struct backtrace_state *state, struct dwarf_data *ddata,
     return callback (data, pc, ln->filename, ln->lineno, NULL);
 
   p = ((struct function_addrs *)
-       bsearch (&pc, entry->u->function_addrs,
-		entry->u->function_addrs_count,
-		sizeof (struct function_addrs),
-		function_addrs_search));
+       bsearch_from (&pc, entry->u->function_addrs,
+		     entry->u->function_addrs_count,
+		     sizeof (struct function_addrs),
+		     function_addrs_search,
+		     cursor != NULL ? cursor->fn : NULL));
   if (p == NULL)
     return callback (data, pc, ln->filename, ln->lineno, NULL);
 
+  if (cursor != NULL)
+    cursor->fn = p;
+
   /* Here pc >= p->low && pc < (p + 1)->low.  The function_addrs are
      sorted by low, so if pc > p->low we are at the end of a range of
      function_addrs with the same low value.  If pc == p->low walk
@@ -3897,26 +3967,63 @@ dwarf_lookup_pc (struct backtrace_state *state, struct dwarf_data *ddata,
 }
 
 
+/* Return the cursor for the module at position INDEX in the list of
+   modules, adding cursors to CURSORS as needed.  Return NULL if CURSORS
+   is NULL or on allocation failure.  */
+
+static struct dwarf_pc_cursor *
+dwarf_pc_cursor_for (struct backtrace_state *state,
+		     struct backtrace_vector *cursors, size_t index,
+		     backtrace_error_callback error_callback, void *data)
+{
+  size_t count;
+
+  if (cursors == NULL)
+    return NULL;
+
+  count = cursors->size / sizeof (struct dwarf_pc_cursor);
+  if (index >= count)
+    {
+      size_t add;
+      void *p;
+
+      add = (index + 1 - count) * sizeof (struct dwarf_pc_cursor);
+      p = backtrace_vector_grow (state, add, error_callback, data, cursors);
+      if (p == NULL)
+	return NULL;
+      memset (p, 0, add);
+    }
+
+  return (struct dwarf_pc_cursor *) cursors->base + index;
+}
+
 /* Return the file/line information for a PC using the DWARF mapping
-   we built earlier.  */
+   we built earlier.  If CURSORS is not NULL, it holds one cursor for
+   each module, as for dwarf_lookup_pc.  */
 
 static int
-dwarf_fileline (struct backtrace_state *state, uintptr_t pc,
-		backtrace_full_callback callback,
-		backtrace_error_callback error_callback, void *data)
+dwarf_fileline_1 (struct backtrace_state *state, uintptr_t pc,
+		  backtrace_full_callback callback,
+		  backtrace_error_callback error_callback, void *data,
+		  struct backtrace_vector *cursors)
 {
   struct dwarf_data *ddata;
+  struct dwarf_pc_cursor *cursor;
+  size_t index;
   int found;
   int ret;
 
+  index = 0;
   if (!state->threaded)
     {
       for (ddata = (struct dwarf_data *) state->fileline_data;
 	   ddata != NULL;
 	   ddata = ddata->next)
 	{
+	  cursor = dwarf_pc_cursor_for (state, cursors, index++,
+					error_callback, data);
 	  ret = dwarf_lookup_pc (state, ddata, pc, callback, error_callback,
-				 data, &found);
+				 data, &found, cursor);
 	  if (ret != 0 || found)
 	    return ret;
 	}
@@ -3932,8 +4039,10 @@ dwarf_fileline (struct backtrace_state *state, uintptr_t pc,
 	  if (ddata == NULL)
 	    break;
 
+	  cursor = dwarf_pc_cursor_for (state, cursors, index++,
+					error_callback, data);
 	  ret = dwarf_lookup_pc (state, ddata, pc, callback, error_callback,
-				 data, &found);
+				 data, &found, cursor);
 	  if (ret != 0 || found)
 	    return ret;
 
@@ -3946,6 +4055,56 @@ dwarf_fileline (struct backtrace_state *state, uintptr_t pc,
   return callback (data, pc, NULL, 0, NULL);
 }
 
+/* Return the file/line information for a PC using the DWARF mapping
+   we built earlier.  */
+
+static int
+dwarf_fileline (struct backtrace_state *state, uintptr_t pc,
+		backtrace_full_callback callback,
+		backtrace_error_callback error_callback, void *data)
+{
+  return dwarf_fileline_1 (state, pc, callback, error_callback, data, NULL);
+}
+
+/* Look up each of the COUNT ascending PCs in PCS as FILELINE_FN would.
+   When that is dwarf_fileline, each search in a module starts from where
+   the previous one in that module ended, so that neighbouring PCs share
+   the work of finding their unit, line and function even when the PCs
+   of several modules are interleaved.  */
+
+int
+backtrace_fileline_batch (struct backtrace_state *state,
+			  fileline fileline_fn,
+			  const uintptr_t *pcs, size_t count,
+			  backtrace_full_callback callback,
+			  backtrace_error_callback error_callback,
+			  void *data)
+{
+  struct backtrace_vector cursors;
+  size_t i;
+  int ret;
+
+  memset (&cursors, 0, sizeof cursors);
+  ret = 0;
+  for (i = 0; i < count; ++i)
+    {
+      if (i > 0 && pcs[i] < pcs[i - 1] && cursors.size > 0)
+	memset (cursors.base, 0, cursors.size);
+
+      if (fileline_fn == dwarf_fileline)
+	ret = dwarf_fileline_1 (state, pcs[i], callback, error_callback,
+				data, &cursors);
+      else
+	ret = fileline_fn (state, pcs[i], callback, error_callback, data);
+      if (ret != 0)
+	break;
+    }
+
+  if (cursors.base != NULL)
+    backtrace_vector_free (state, &cursors, error_callback, data);
+  return ret;
+}
+
 /* Initialize our data structures from the DWARF debug info for a
    file.  Return NULL on failure.  */
 
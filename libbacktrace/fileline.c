@@ -301,6 +301,24 @@ backtrace_pcinfo (struct backtrace_state *state, uintptr_t pc,
   return state->fileline_fn (state, pc, callback, error_callback, data);
 }
 
+/* Given an ascending array of PCs, find the file name, line number,
+   and function name of each.  */
+
+int
+backtrace_pcinfo_batch (struct backtrace_state *state, const uintptr_t *pcs,
+			size_t count, backtrace_full_callback callback,
+			backtrace_error_callback error_callback, void *data)
+{
+  if (!fileline_initialize (state, error_callback, data))
+    return 0;
+
+  if (state->fileline_initialization_failed)
+    return 0;
+
+  return backtrace_fileline_batch (state, state->fileline_fn, pcs, count,
+				   callback, error_callback, data);
+}
+
 /* Given a PC, find the symbol for it, and its value.  */
 
 int
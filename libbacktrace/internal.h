@@ -334,6 +334,18 @@ extern int backtrace_dwarf_add (struct backtrace_state *state,
 				void *data, fileline *fileline_fn,
 				struct dwarf_data **fileline_entry);
 
+/* Look up each of the COUNT PCs in PCS, which should be in ascending
+   order, by calling FILELINE_FN or sharing work between neighbouring
+   PCs if FILELINE_FN is the DWARF reader's.  This is like
+   backtrace_pcinfo_batch.  */
+
+extern int backtrace_fileline_batch (struct backtrace_state *state,
+				     fileline fileline_fn,
+				     const uintptr_t *pcs, size_t count,
+				     backtrace_full_callback callback,
+				     backtrace_error_callback error_callback,
+				     void *data);
+
 /* A data structure to pass to backtrace_syminfo_to_full.  */
 
 struct backtrace_call_full
@@ -2949,14 +2949,14 @@ _cpp_convert_input (cpp_reader *pfile, const char *input_charset,
 
   /* Resize buffer if we allocated substantially too much, or if we
      haven't enough space for the \n-terminator or following
-     15 bytes of padding (used to quiet warnings from valgrind or
+     63 bytes of padding (used to quiet warnings from valgrind or
      Address Sanitizer, when the optimized lexer accesses aligned
-     16-byte memory chunks, including the bytes after the malloced,
-     area, and stops lexing on '\n').  */
-  if (to.len + 4096 < to.asize || to.len + 16 > to.asize)
-    to.text = XRESIZEVEC (uchar, to.text, to.len + 16);
+     memory chunks of up to 64 bytes, including the bytes after the
+     malloced, area, and stops lexing on '\n').  */
+  if (to.len + 4096 < to.asize || to.len + 64 > to.asize)
+    to.text = XRESIZEVEC (uchar, to.text, to.len + 64);
 
-  memset (to.text + to.len, '\0', 16);
+  memset (to.text + to.len, '\0', 64);
 
   /* If the file is using old-school Mac line endings (\r only),
      terminate with another \r, not an \n, so that we do not mistake
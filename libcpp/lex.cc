@@ -490,6 +490,112 @@ search_line_sse42 (const uchar *s, const uchar *end)
 #define search_line_sse42 search_line_sse2
 #endif
 
+#if defined(HAVE_AVX2) && GCC_VERSION >= 4008
+/* A version of the fast scanner using AVX2 vectorized byte compare insns,
+   processing 32 bytes at a time.  As for SSE2, we only perform aligned
+   loads, so that we can never read past the end of the page containing
+   the final newline of the buffer.  */
+
+static const uchar *
+#ifndef __AVX2__
+__attribute__((__target__("avx2")))
+#endif
+search_line_avx2 (const uchar *s, const uchar *end ATTRIBUTE_UNUSED)
+{
+  typedef char v32qi __attribute__ ((__vector_size__ (32)));
+
+  unsigned int misalign, found, mask;
+  const v32qi *p;
+  v32qi data, t;
+
+  /* Align the source pointer.  */
+  misalign = (uintptr_t)s & 31;
+  p = (const v32qi *)((uintptr_t)s & -32);
+  data = *p;
+
+  /* Create a mask for the bytes that are valid within the first
+     32-byte block.  */
+  mask = -1u << misalign;
+
+  /* Main loop processing 32 bytes at a time.  */
+  goto start;
+  do
+    {
+      data = *++p;
+      mask = -1;
+
+    start:
+      t  = data == '\n';
+      t |= data == '\r';
+      t |= data == '\\';
+      t |= data == '?';
+      found = __builtin_ia32_pmovmskb256 (t);
+      found &= mask;
+    }
+  while (!found);
+
+  found = __builtin_ctz (found);
+  return (const uchar *)p + found;
+}
+#else
+#define search_line_avx2 search_line_sse42
+#endif
+
+#if defined(HAVE_AVX512BW) && GCC_VERSION >= 5000
+/* A version of the fast scanner using AVX-512BW byte compares into mask
+   registers, processing 64 bytes at a time.  */
+
+static const uchar *
+#ifndef __AVX512BW__
+__attribute__((__target__("avx512bw")))
+#endif
+search_line_avx512bw (const uchar *s, const uchar *end ATTRIBUTE_UNUSED)
+{
+  typedef char v64qi __attribute__ ((__vector_size__ (64)));
+
+  const v64qi zero = { 0 };
+  const v64qi repl_nl = zero + '\n';
+  const v64qi repl_cr = zero + '\r';
+  const v64qi repl_bs = zero + '\\';
+  const v64qi repl_qm = zero + '?';
+
+  unsigned long long found, mask;
+  unsigned int misalign;
+  const v64qi *p;
+  v64qi data;
+
+  /* Align the source pointer.  */
+  misalign = (uintptr_t)s & 63;
+  p = (const v64qi *)((uintptr_t)s & -64);
+  data = *p;
+
+  /* Create a mask for the bytes that are valid within the first
+     64-byte block.  */
+  mask = -1ull << misalign;
+
+  /* Main loop processing 64 bytes at a time.  The compares write
+     straight into mask registers, so there is no separate movemask.  */
+  goto start;
+  do
+    {
+      data = *++p;
+      mask = -1ull;
+
+    start:
+      found  = __builtin_ia32_pcmpeqb512_mask (data, repl_nl, mask);
+      found |= __builtin_ia32_pcmpeqb512_mask (data, repl_cr, mask);
+      found |= __builtin_ia32_pcmpeqb512_mask (data, repl_bs, mask);
+      found |= __builtin_ia32_pcmpeqb512_mask (data, repl_qm, mask);
+    }
+  while (!found);
+
+  found = __builtin_ctzll (found);
+  return (const uchar *)p + found;
+}
+#else
+#define search_line_avx512bw search_line_avx2
+#endif
+
 /* Check the CPU capabilities.  */
 
 #include "../gcc/config/i386/cpuid.h"
@@ -531,6 +637,24 @@ init_vectorized_lexer (void)
 	impl = search_line_mmx;
     }
 
+  /* The wider scanners additionally need the OS to save the YMM, and
+     for AVX-512 the opmask and ZMM, register state.  ECX is not set
+     above when SSE4.2 is known at compile time, so query it again.  */
+  if (impl == search_line_sse42
+      && __get_cpuid (1, &dummy, &dummy, &ecx, &edx)
+      && (ecx & bit_OSXSAVE))
+    {
+      unsigned int ebx = 0, xcrlow, xcrhigh;
+
+      __asm__ (".byte 0x0f, 0x01, 0xd0"
+	       : "=a" (xcrlow), "=d" (xcrhigh) : "c" (0));
+      __get_cpuid_count (7, 0, &dummy, &ebx, &dummy, &dummy);
+      if ((xcrlow & 0xe6) == 0xe6 && (ebx & bit_AVX512BW))
+	impl = search_line_avx512bw;
+      else if ((xcrlow & 0x6) == 0x6 && (ebx & bit_AVX2))
+	impl = search_line_avx2;
+    }
+
   search_line_fast = impl;
 }
 
@@ -5631,6 +5755,20 @@ cpp_directive_only_process (cpp_reader *pfile,
 	    dflt:
 	      bol = false;
 	      pfile->mi_valid = false;
+
+	      /* Past the start of a line, nothing but line ends, escapes,
+		 comments and literals can matter, so skip everything
+		 else without dispatching on it.  This is not
+		 search_line_fast's set, which is meant for cleaning lines
+		 and does not look for comments or literals.  */
+	      while (pos < limit)
+		{
+		  c = *pos;
+		  if (c == '\n' || c == '\r' || c == '\\' || c == '/'
+		      || c == '\'' || c == '\"')
+		    break;
+		  pos++;
+		}
 	      break;
 	    }
 	}
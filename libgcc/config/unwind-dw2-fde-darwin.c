@@ -41,10 +41,15 @@ typedef int __gthread_mutex_t;
 
 static const fde * _Unwind_Find_registered_FDE (void *pc,
 						struct dwarf_eh_bases *bases);
+static int _Unwind_Find_registered_Object_Id (void *pc,
+					      struct dwarf_object_id *id)
+  __attribute__ ((__unused__));
 
 #define _Unwind_Find_FDE _Unwind_Find_registered_FDE
+#define _Unwind_Find_Object_Id _Unwind_Find_registered_Object_Id
 #include "unwind-dw2-fde.c"
 #undef _Unwind_Find_FDE
+#undef _Unwind_Find_Object_Id
 
 /* KeyMgr stuff.  */
 #define KEYMGR_GCC3_LIVE_IMAGE_LIST     301     /* loaded images  */
@@ -273,3 +278,13 @@ _Unwind_Find_FDE (void *pc, struct dwarf_eh_bases *bases)
 					  the_obj_info);
   return ret;
 }
+
+/* Images are added and removed through keymgr, which cannot be checked
+   without taking its lock, so decoded frame state is never cached.  */
+
+int
+_Unwind_Find_Object_Id (void *pc __attribute__ ((__unused__)),
+			struct dwarf_object_id *id __attribute__ ((__unused__)))
+{
+  return 0;
+}
@@ -92,10 +92,15 @@
 #endif
 
 static const fde * _Unwind_Find_registered_FDE (void *pc, struct dwarf_eh_bases *bases);
+static int _Unwind_Find_registered_Object_Id (void *pc,
+					      struct dwarf_object_id *id)
+  __attribute__ ((__unused__));
 
 #define _Unwind_Find_FDE _Unwind_Find_registered_FDE
+#define _Unwind_Find_Object_Id _Unwind_Find_registered_Object_Id
 #include "unwind-dw2-fde.c"
 #undef _Unwind_Find_FDE
+#undef _Unwind_Find_Object_Id
 
 #ifndef PT_GNU_EH_FRAME
 #define PT_GNU_EH_FRAME (PT_LOOS + 0x474e550)
@@ -532,6 +537,29 @@ find_fde_tail (_Unwind_Ptr pc,
   return entry;
 }
 
+/* Objects loaded by the dynamic linker are not registered, so they have
+   to be told apart by _dl_find_object, which does not take the loader
+   lock.  Without it, there is no way to check them that does not.  */
+
+int
+_Unwind_Find_Object_Id (void *pc, struct dwarf_object_id *id)
+{
+#ifdef DLFO_STRUCT_HAS_EH_DBASE
+  struct dl_find_object dlfo;
+
+  if (_dl_find_object (pc, &dlfo) == 0)
+    {
+      id->object = dlfo.dlfo_link_map;
+      id->eh_frame = dlfo.dlfo_eh_frame;
+      id->map_end = dlfo.dlfo_map_end;
+      return 1;
+    }
+  return _Unwind_Find_registered_Object_Id (pc, id);
+#else
+  return 0;
+#endif
+}
+
 const fde *
 _Unwind_Find_FDE (void *pc, struct dwarf_eh_bases *bases)
 {
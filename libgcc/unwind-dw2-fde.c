@@ -76,6 +76,9 @@ static struct object *unseen_objects;
 static struct object *seen_objects;
 #endif
 
+/* Count of deregistered objects, for _Unwind_Frame_Generation.  */
+static unsigned int deregistered_objects;
+
 #ifdef __GTHREAD_MUTEX_INIT
 static __gthread_mutex_t object_mutex = __GTHREAD_MUTEX_INIT;
 #define init_object_mutex_once()
@@ -240,6 +243,8 @@ __deregister_frame_info_bases (const void *begin)
 
   // And remove
   ob = btree_remove (&registered_frames, range[0]);
+  if (ob)
+    __atomic_fetch_add (&deregistered_objects, 1, __ATOMIC_RELEASE);
 #else
   init_object_mutex_once ();
   __gthread_mutex_lock (&object_mutex);
@@ -275,6 +280,8 @@ __deregister_frame_info_bases (const void *begin)
       }
 
  out:
+  if (ob)
+    __atomic_fetch_add (&deregistered_objects, 1, __ATOMIC_RELEASE);
   __gthread_mutex_unlock (&object_mutex);
 #endif
 
@@ -1179,6 +1186,22 @@ is_object_initialized (struct object *ob)
 
 #endif
 
+unsigned long long
+_Unwind_Frame_Generation (void)
+{
+  return __atomic_load_n (&deregistered_objects, __ATOMIC_ACQUIRE);
+}
+
+int
+_Unwind_Find_Object_Id (void *pc __attribute__ ((__unused__)),
+			struct dwarf_object_id *id)
+{
+  /* All unwind info is registered, so _Unwind_Frame_Generation alone
+     tells when any of it goes away.  */
+  id->object = id->eh_frame = id->map_end = 0;
+  return 1;
+}
+
 const fde *
 _Unwind_Find_FDE (void *pc, struct dwarf_eh_bases *bases)
 {
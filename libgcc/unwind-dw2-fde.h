@@ -165,6 +165,23 @@ next_fde (const fde *f)
 
 extern const fde * _Unwind_Find_FDE (void *, struct dwarf_eh_bases *);
 
+/* Return a value that changes whenever unwind info registered through
+   __register_frame_info and friends is removed.  */
+extern unsigned long long _Unwind_Frame_Generation (void);
+
+/* Identifies the loaded object whose unwind info _Unwind_Find_FDE uses
+   for a PC; all zeros for unwind info registered at run time.  */
+struct dwarf_object_id
+{
+  const void *object;
+  const void *eh_frame;
+  const void *map_end;
+};
+
+/* Store in *ID the identity of the object holding the unwind info for PC.
+   Return zero if that cannot be done without taking locks.  */
+extern int _Unwind_Find_Object_Id (void *pc, struct dwarf_object_id *id);
+
 static inline int
 last_fde (const struct object *obj __attribute__ ((__unused__)), const fde *f)
 {
@@ -982,6 +982,82 @@ execute_cfa_program (const unsigned char *insn_ptr,
 }
 
 
+/* Decoding the frame state for a PC means looking up its FDE, parsing
+   the CIE and running both CFA programs.  Code that throws or takes
+   backtraces frequently visits the same frames over and over, so each
+   thread remembers the decoded state of recently seen return addresses.
+
+   Nothing here takes a lock.  Each entry records the identity of the
+   object its unwind info came from, which _Unwind_Find_Object_Id
+   recomputes on every hit, so entries for unloaded objects are never
+   used.  Frames whose object cannot be identified that way are not
+   cached.  Removal of unwind info registered at run time is noticed
+   through _Unwind_Frame_Generation, which is checked once at the start
+   of each unwind: the frames on the stack being unwound cannot go away
+   until the unwind has finished.
+
+   The cache lives in TLS, so every thread pays for it.  An entry is
+   about 300 bytes on x86_64, and eight of them cover the frames between
+   a typical throw and its handler.  Targets with many more DWARF
+   registers would need much bigger entries and go without.  */
+
+#ifndef FRAME_STATE_CACHE_SIZE
+#define FRAME_STATE_CACHE_SIZE 8
+#endif
+
+#if FRAME_STATE_CACHE_SIZE > 0 && __LIBGCC_DWARF_FRAME_REGISTERS__ <= 32 \
+    && defined (HAVE_CC_TLS) && !defined (USE_EMUTLS)
+#define USE_FRAME_STATE_CACHE 1
+
+struct frame_state_cache_entry
+{
+  void *ra;
+  _Unwind_Word signal_frame;
+  struct dwarf_object_id id;
+  struct dwarf_eh_bases bases;
+  void *lsda;
+  _Unwind_Word args_size;
+  _Unwind_FrameState fs;
+};
+
+static __thread struct
+{
+  unsigned long long generation;
+  struct frame_state_cache_entry entries[FRAME_STATE_CACHE_SIZE];
+} frame_state_cache;
+
+static inline struct frame_state_cache_entry *
+frame_state_cache_slot (void *ra)
+{
+  _Unwind_Ptr h = (_Unwind_Ptr) ra;
+
+  h ^= h >> 12;
+  return &frame_state_cache.entries[h % FRAME_STATE_CACHE_SIZE];
+}
+
+/* Flush the cache if registered unwind info has been removed since it
+   was filled.  */
+
+static void
+uw_frame_state_cache_validate (void)
+{
+  unsigned long long gen = _Unwind_Frame_Generation ();
+  int i;
+
+  if (gen == frame_state_cache.generation)
+    return;
+
+  for (i = 0; i < FRAME_STATE_CACHE_SIZE; i++)
+    frame_state_cache.entries[i].ra = 0;
+  frame_state_cache.generation = gen;
+}
+#else
+static inline void
+uw_frame_state_cache_validate (void)
+{
+}
+#endif
+
 /* Given the _Unwind_Context CONTEXT for a stack frame, look up the FDE for
    its caller and decode it into FS.  This function also sets the
    args_size and lsda members of CONTEXT, as they are really information
@@ -993,6 +1069,32 @@ uw_frame_state_for (struct _Unwind_Context *context, _Unwind_FrameState *fs)
   const struct dwarf_fde *fde;
   const struct dwarf_cie *cie;
   const unsigned char *aug, *insn, *end;
+#ifdef USE_FRAME_STATE_CACHE
+  struct frame_state_cache_entry *slot = NULL;
+  struct dwarf_object_id id;
+  int cacheable = 0;
+
+  if (context->ra != 0)
+    {
+      cacheable
+	= _Unwind_Find_Object_Id (context->ra
+				  + _Unwind_IsSignalFrame (context) - 1, &id);
+      slot = frame_state_cache_slot (context->ra);
+      if (cacheable
+	  && slot->ra == context->ra
+	  && slot->signal_frame == _Unwind_IsSignalFrame (context)
+	  && slot->id.object == id.object
+	  && slot->id.eh_frame == id.eh_frame
+	  && slot->id.map_end == id.map_end)
+	{
+	  *fs = slot->fs;
+	  context->bases = slot->bases;
+	  context->lsda = slot->lsda;
+	  context->args_size = slot->args_size;
+	  return _URC_NO_REASON;
+	}
+    }
+#endif
 
   memset (&fs->regs.how[0], 0,
 	  sizeof (*fs) - offsetof (_Unwind_FrameState, regs.how[0]));
@@ -1052,6 +1154,20 @@ uw_frame_state_for (struct _Unwind_Context *context, _Unwind_FrameState *fs)
   end = (const unsigned char *) next_fde (fde);
   execute_cfa_program (insn, end, context, fs);
 
+#ifdef USE_FRAME_STATE_CACHE
+  if (!cacheable)
+    return _URC_NO_REASON;
+
+  slot->ra = context->ra;
+  slot->signal_frame = _Unwind_IsSignalFrame (context);
+  slot->id = id;
+  slot->bases = context->bases;
+  slot->lsda = context->lsda;
+  slot->args_size = context->args_size;
+  slot->fs = *fs;
+  slot->fs.regs.prev = NULL;
+#endif
+
   return _URC_NO_REASON;
 }
 
@@ -1085,6 +1201,7 @@ __frame_state_for (void *pc_target, struct frame_state *state_in)
     context.flags = EXTENDED_CONTEXT_BIT;
   context.ra = pc_target + 1;
 
+  uw_frame_state_cache_validate ();
   if (uw_frame_state_for (&context, &fs) != _URC_NO_REASON)
     return 0;
 
@@ -1332,6 +1449,7 @@ uw_init_context_1 (struct _Unwind_Context *context,
   if (!ASSUME_EXTENDED_UNWIND_CONTEXT)
     context->flags = EXTENDED_CONTEXT_BIT;
 
+  uw_frame_state_cache_validate ();
   code = uw_frame_state_for (context, &fs);
   gcc_assert (code == _URC_NO_REASON);
 